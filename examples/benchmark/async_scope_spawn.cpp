@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the throughput of exec::async_scope::spawn and spawn_future with that of
+// stdexec::start_detached. Each operation completes inline, so the numbers measure the cost of
+// allocating, starting, and completing the spawned operations and, for spawn_future, of handing
+// the result over to the future.
+//
+// Usage: example.benchmark.async_scope_spawn [n_operations] [recycling]
+//
+// With "recycling", the operations are allocated with exec::recycling_allocator.
+
+#include <exec/async_scope.hpp>
+#include <exec/recycling_allocator.hpp>
+#include <stdexec/execution.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace ex = stdexec;
+
+namespace {
+  struct sink_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value(int value) noexcept {
+      *sum_ += value;
+    }
+
+    void set_stopped() noexcept {
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+      std::terminate();
+    }
+
+    long* sum_;
+  };
+
+  template <class Fn>
+  auto measure(std::size_t n_operations, Fn fn) -> double {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(n_operations) / seconds / 1e6;
+  }
+
+  template <class Env>
+  void run(std::size_t n_operations, Env env) {
+    exec::async_scope scope;
+    long sum = 0;
+    auto add_one = ex::then([&sum] { ++sum; });
+
+    double detached = measure(n_operations, [&] { ex::start_detached(ex::just() | add_one, env); });
+    double spawned = measure(n_operations, [&] { scope.spawn(ex::just() | add_one, env); });
+    double dropped = measure(n_operations, [&] { (void) scope.spawn_future(ex::just(1), env); });
+    double awaited = measure(n_operations, [&] {
+      auto op = ex::connect(scope.spawn_future(ex::just(1), env), sink_receiver{&sum});
+      ex::start(op);
+    });
+    ex::sync_wait(scope.on_empty());
+
+    std::cout << "operations: " << n_operations << ", start_detached: " << detached << " M/s"
+              << ", spawn: " << spawned << " M/s"
+              << ", spawn_future (dropped): " << dropped << " M/s"
+              << ", spawn_future (awaited): " << awaited << " M/s" << '\n';
+    if (sum != static_cast<long>(3 * n_operations)) {
+      std::cerr << "mismatch: " << sum << '\n';
+    }
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_operations = 10'000'000;
+  bool recycling = false;
+  if (argc > 1) {
+    n_operations = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+  if (argc > 2) {
+    recycling = std::string_view{argv[2]} == "recycling";
+  }
+
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    if (recycling) {
+      run(n_operations, ex::prop{ex::get_allocator, exec::recycling_allocator<std::byte>{}});
+    } else {
+      run(n_operations, ex::env<>{});
+    }
+  }
+}
@@ -22,10 +22,13 @@
 #include <barrier>
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <memory>
+#include <optional>
 #include <span>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -105,19 +108,41 @@ struct numa_deleter {
   }
 };
 
+//! Usage: <benchmark> [nthreads [simulated_numa_nodes [remote_delay_ns]]]
+//!
+//! If a number of simulated NUMA nodes is given, a `static_thread_pool` spreads its threads
+//! evenly over that many nodes of a `simulated_numa_policy`, and taking over work queued on
+//! another node costs the given delay. The number of such remote accesses is reported at the end.
+//!
+//! If the environment variable `STDEXEC_BENCHMARK_TOPOLOGY` is set, a `static_thread_pool`
+//! steals along the rings of the CPU topology read from sysfs, and with the value `pin` it also
+//! pins its threads to their CPUs.
 template <class Pool, class RunThread>
-void my_main(int argc, char** argv, exec::numa_policy policy = exec::get_numa_policy()) {
+void my_main(int argc, char** argv, exec::numa_policy numa = exec::get_numa_policy()) {
   int nthreads = static_cast<int>(std::thread::hardware_concurrency());
   if (argc > 1) {
     nthreads = std::atoi(argv[1]);
   }
+  std::optional<exec::simulated_numa_policy> simulated{};
+  if (argc > 2) {
+    auto nodes = static_cast<std::size_t>(std::max(std::atoi(argv[2]), 1));
+    auto cpus_per_node = (static_cast<std::size_t>(nthreads) + nodes - 1) / nodes;
+    std::chrono::nanoseconds remote_delay{argc > 3 ? std::atoll(argv[3]) : 0};
+    simulated.emplace(nodes, cpus_per_node, remote_delay);
+  }
+  exec::numa_policy policy = simulated ? exec::numa_policy{*simulated} : std::move(numa);
   std::size_t total_scheds = 10'000'000;
 #ifndef STDEXEC_NO_MONOTONIC_BUFFER_RESOURCE
   std::vector<std::unique_ptr<char, numa_deleter>> buffers;
 #endif
   std::optional<Pool> pool{};
   if constexpr (std::same_as<Pool, exec::static_thread_pool>) {
-    pool.emplace(nthreads, exec::bwos_params{}, policy);
+    exec::topology_params topology{};
+    if (const char* mode = std::getenv("STDEXEC_BENCHMARK_TOPOLOGY")) {
+      topology.topology = exec::cpu_topology::from_sysfs();
+      topology.pin_threads = std::string_view{mode} == "pin";
+    }
+    pool.emplace(nthreads, exec::bwos_params{}, policy, std::move(topology));
   } else {
     pool.emplace(nthreads);
   }
@@ -175,4 +200,7 @@ void my_main(int argc, char** argv, exec::numa_policy policy = exec::get_numa_po
   auto [dur_ms, ops_per_sec, avg, max, min, stddev] =
     compute_perf(starts, ends, warmup, nRuns - 1, total_scheds);
   std::cout << avg << " | " << max << " | " << min << " | " << stddev << "\n";
+  if (simulated) {
+    std::cout << "remote accesses: " << simulated->remote_accesses() << "\n";
+  }
 }
\ No newline at end of file
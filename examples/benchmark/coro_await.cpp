@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the time and the number of heap allocations of awaiting senders in an exec::task,
+// and of connecting tasks as senders, which wraps them in a coroutine frame of its own. The
+// operation states of awaited senders live in the awaiters, so awaiting a sender does not
+// allocate. The frame of the wrapping coroutine is allocated with the allocator of the
+// receiver's environment if it has one.
+//
+// Usage: example.benchmark.coro_await [n_operations]
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/recycling_allocator.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <exec/task.hpp>
+#include <stdexec/execution.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <new>
+
+namespace ex = stdexec;
+
+namespace {
+  std::atomic<std::size_t> allocations{0};
+} // namespace
+
+auto operator new(std::size_t size) -> void* {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+  struct result {
+    double ns;
+    double allocations;
+  };
+
+  template <class Fn>
+  auto measure(std::size_t n_operations, Fn fn) -> result {
+    std::size_t before = allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    std::size_t after = allocations.load();
+    return {
+      std::chrono::duration<double, std::nano>(end - start).count()
+        / static_cast<double>(n_operations),
+      static_cast<double>(after - before) / static_cast<double>(n_operations)};
+  }
+
+  auto await_just(std::size_t n_operations) -> exec::task<long> {
+    long sum = 0;
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      sum += co_await ex::just(1L);
+    }
+    co_return sum;
+  }
+
+  auto await_schedule(exec::static_thread_pool::scheduler sched, std::size_t n_operations)
+    -> exec::task<long> {
+    long sum = 0;
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      co_await ex::schedule(sched);
+      ++sum;
+    }
+    co_return sum;
+  }
+
+  auto one_await() -> exec::task<long> {
+    co_return co_await ex::just(1L);
+  }
+
+  struct sink_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value(long value) noexcept {
+      *sum_ += value;
+    }
+
+    void set_stopped() noexcept {
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+      std::terminate();
+    }
+
+    auto get_env() const noexcept {
+      return ex::prop{ex::get_scheduler, exec::inline_scheduler{}};
+    }
+
+    long* sum_;
+  };
+
+  struct recycling_receiver : sink_receiver {
+    auto get_env() const noexcept {
+      return ex::env{
+        ex::prop{ex::get_scheduler, exec::inline_scheduler{}},
+        ex::prop{ex::get_allocator, exec::recycling_allocator<std::byte>{}}};
+    }
+  };
+
+  template <class Receiver>
+  auto connect_tasks(std::size_t n_operations) -> long {
+    long sum = 0;
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      auto op = ex::connect(one_await(), Receiver{{&sum}});
+      ex::start(op);
+    }
+    return sum;
+  }
+
+  void print(const char* name, result r) {
+    std::cout << name << ": " << r.ns << " ns, " << r.allocations << " allocations; ";
+  }
+
+  void run(exec::static_thread_pool& pool, std::size_t n_operations) {
+    auto sched = pool.get_scheduler();
+    print("co_await just", measure(n_operations, [&] {
+            ex::sync_wait(ex::starts_on(sched, await_just(n_operations)));
+          }));
+    print("co_await schedule", measure(n_operations, [&] {
+            ex::sync_wait(ex::starts_on(sched, await_schedule(sched, n_operations)));
+          }));
+    print("connect task", measure(n_operations, [&] {
+            connect_tasks<sink_receiver>(n_operations);
+          }));
+    print("connect task (recycling)", measure(n_operations, [&] {
+            connect_tasks<recycling_receiver>(n_operations);
+          }));
+    std::cout << '\n';
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_operations = 1'000'000;
+  if (argc > 1) {
+    n_operations = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+
+  exec::static_thread_pool pool{1};
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    run(pool, n_operations);
+  }
+}
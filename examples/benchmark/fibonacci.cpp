@@ -21,6 +21,7 @@
 #include <exec/static_thread_pool.hpp>
 
 #include <exec/any_sender_of.hpp>
+#include <exec/recycling_allocator.hpp>
 #include <stdexec/execution.hpp>
 
 auto serial_fib(long n) -> long {
@@ -33,7 +34,28 @@ using any_sender_of =
 
 using fib_sender = any_sender_of<stdexec::set_value_t(long)>;
 
-template <typename Scheduler>
+// With "recycling", the type-erased senders and operation states are stored inline, and the
+// operation states of start_detached come from a recycling allocator.
+using recycling_storage = exec::
+  any_sender_storage<8 * sizeof(void*), 16 * sizeof(void*), exec::recycling_allocator<std::byte>>;
+
+using recycling_fib_sender =
+  exec::any_receiver_ref<stdexec::completion_signatures<stdexec::set_value_t(long)>>::
+    template any_sender<recycling_storage{}>;
+
+template <bool Recycling>
+using fib_sender_t = std::conditional_t<Recycling, recycling_fib_sender, fib_sender>;
+
+template <bool Recycling>
+auto detached_env() {
+  if constexpr (Recycling) {
+    return stdexec::prop{stdexec::get_allocator, exec::recycling_allocator<std::byte>{}};
+  } else {
+    return stdexec::env<>{};
+  }
+}
+
+template <typename Scheduler, bool Recycling = false>
 struct fib_s {
   using sender_concept = stdexec::sender_t;
   using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(long)>;
@@ -54,14 +76,15 @@ struct fib_s {
         stdexec::set_value(static_cast<Receiver&&>(rcvr_), serial_fib(n));
       } else {
         auto mkchild = [&](long n) {
-          return stdexec::starts_on(sched, fib_sender(fib_s{cutoff, n, sched}));
+          return stdexec::starts_on(sched, fib_sender_t<Recycling>(fib_s{cutoff, n, sched}));
         };
 
         stdexec::start_detached(
           stdexec::when_all(mkchild(n - 1), mkchild(n - 2))
-          | stdexec::then([rcvr = static_cast<Receiver&&>(rcvr_)](long a, long b) mutable {
-              stdexec::set_value(static_cast<Receiver&&>(rcvr), a + b);
-            }));
+            | stdexec::then([rcvr = static_cast<Receiver&&>(rcvr_)](long a, long b) mutable {
+                stdexec::set_value(static_cast<Receiver&&>(rcvr), a + b);
+              }),
+          detached_env<Recycling>());
       }
     }
   };
@@ -82,9 +105,31 @@ auto measure(F&& f) {
   return std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - start).count();
 }
 
+template <bool Recycling, class Pool>
+auto run(Pool& pool, long cutoff, long n, std::size_t nruns, long& result)
+  -> std::vector<unsigned long> {
+  std::vector<unsigned long> times;
+  for (unsigned long i = 0; i < nruns; ++i) {
+    auto snd = std::visit(
+      [&](auto&& pool) {
+        using scheduler_t = decltype(pool.get_scheduler());
+        return fib_sender_t<Recycling>(
+          fib_s<scheduler_t, Recycling>{cutoff, n, pool.get_scheduler()});
+      },
+      pool);
+
+    auto time = measure<std::chrono::milliseconds>([&] {
+      std::tie(result) = stdexec::sync_wait(std::move(snd)).value();
+    });
+    times.push_back(static_cast<unsigned int>(time));
+  }
+  return times;
+}
+
 auto main(int argc, char** argv) -> int {
   if (argc < 5) {
-    std::cerr << "Usage: example.benchmark.fibonacci cutoff n nruns {tbb|static}" << std::endl;
+    std::cerr << "Usage: example.benchmark.fibonacci cutoff n nruns {tbb|static} [recycling]"
+              << std::endl;
     return -1;
   }
 
@@ -109,17 +154,10 @@ auto main(int argc, char** argv) -> int {
       std::thread::hardware_concurrency(), exec::bwos_params{}, exec::get_numa_policy());
   }
 
-  std::vector<unsigned long> times;
   long result;
-  for (unsigned long i = 0; i < nruns; ++i) {
-    auto snd = std::visit(
-      [&](auto&& pool) { return fib_sender(fib_s{cutoff, n, pool.get_scheduler()}); }, pool);
-
-    auto time = measure<std::chrono::milliseconds>([&] {
-      std::tie(result) = stdexec::sync_wait(std::move(snd)).value();
-    });
-    times.push_back(static_cast<unsigned int>(time));
-  }
+  std::vector<unsigned long> times = argc > 5 && argv[5] == std::string_view("recycling")
+                                     ? run<true>(pool, cutoff, n, nruns, result)
+                                     : run<false>(pool, cutoff, n, nruns, result);
 
   std::cout << "Avg time: "
             << (std::accumulate(times.begin() + warmup, times.end(), 0u) / (times.size() - warmup))
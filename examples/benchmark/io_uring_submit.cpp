@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the throughput of submitting io operations from N producer threads
+// to a single io_uring_context, once with one submission per operation and once
+// with submission batches.
+//
+// Usage: example.benchmark.io_uring_submit [n_producers] [batch_size]
+
+#include <exec/linux/io_uring_context.hpp>
+
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+  constexpr std::size_t total_ops = 2'000'000;
+
+  auto run(exec::io_uring_context& context, std::size_t n_producers, std::size_t batch_size)
+    -> double {
+    auto scheduler = context.get_scheduler();
+    std::atomic<std::size_t> n_completed{0};
+    std::barrier<> barrier(static_cast<std::ptrdiff_t>(n_producers + 1));
+    std::vector<std::thread> producers;
+    const std::size_t ops_per_producer = total_ops / n_producers;
+    for (std::size_t i = 0; i < n_producers; ++i) {
+      producers.emplace_back([&] {
+        auto submit_one = [&] {
+          stdexec::start_detached(
+            stdexec::schedule(scheduler)
+            | stdexec::then([&] { n_completed.fetch_add(1, std::memory_order_relaxed); }));
+        };
+        barrier.arrive_and_wait();
+        if (batch_size <= 1) {
+          for (std::size_t n = 0; n < ops_per_producer; ++n) {
+            submit_one();
+          }
+        } else {
+          for (std::size_t n = 0; n < ops_per_producer; n += batch_size) {
+            exec::io_uring_context::submission_batch batch{context};
+            for (std::size_t k = n; k < std::min(n + batch_size, ops_per_producer); ++k) {
+              submit_one();
+            }
+          }
+        }
+      });
+    }
+    barrier.arrive_and_wait();
+    auto start = std::chrono::steady_clock::now();
+    for (auto& producer: producers) {
+      producer.join();
+    }
+    while (n_completed.load(std::memory_order_relaxed) < ops_per_producer * n_producers) {
+      std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> seconds = end - start;
+    return static_cast<double>(ops_per_producer * n_producers) / seconds.count();
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_producers = std::max(1u, std::thread::hardware_concurrency() - 1);
+  std::size_t batch_size = 64;
+  if (argc > 1) {
+    n_producers = static_cast<std::size_t>(std::atoi(argv[1]));
+  }
+  if (argc > 2) {
+    batch_size = static_cast<std::size_t>(std::atoi(argv[2]));
+  }
+  exec::io_uring_context context;
+  std::thread io_thread{[&] {
+    context.run_until_stopped();
+  }};
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    double single = run(context, n_producers, 1);
+    double batched = run(context, n_producers, batch_size);
+    std::cout << "producers: " << n_producers << ", single: " << std::setprecision(3) << single
+              << " ops/s, batches of " << batch_size << ": " << batched << " ops/s\n";
+  }
+  context.request_stop();
+  io_thread.join();
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the bandwidth of a memory-bound bulk kernel on a static_thread_pool, once over an
+// array that the calling thread initialized, which places all of it on the calling thread's
+// NUMA node, and once over an array that was initialized with exec::numa_first_touch, which
+// places each part on the node whose threads process it. On a host with a single NUMA node,
+// both are expected to be the same.
+//
+// Usage: example.benchmark.numa_bulk [n_megabytes [n_threads]]
+
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace ex = stdexec;
+
+namespace {
+  auto measure(exec::static_thread_pool& pool, const double* data, std::size_t size) -> double {
+    std::atomic<double> total{0.0};
+    auto start = std::chrono::steady_clock::now();
+    constexpr int n_reps = 10;
+    for (int rep = 0; rep < n_reps; ++rep) {
+      ex::sync_wait(
+        ex::schedule(pool.get_scheduler())
+        | ex::bulk_chunked(ex::par, size, [&](std::size_t begin, std::size_t end) {
+            double sum = 0.0;
+            for (std::size_t i = begin; i < end; ++i) {
+              sum += data[i];
+            }
+            total.fetch_add(sum, std::memory_order_relaxed);
+          }));
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (total.load() != static_cast<double>(n_reps) * static_cast<double>(size)) {
+      std::cerr << "mismatch: " << total.load() << '\n';
+    }
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(n_reps * size * sizeof(double)) / seconds / 1e9;
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_megabytes = 512;
+  if (argc > 1) {
+    n_megabytes = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+  auto n_threads = static_cast<std::uint32_t>(std::thread::hardware_concurrency());
+  if (argc > 2) {
+    n_threads = static_cast<std::uint32_t>(std::atoi(argv[2]));
+  }
+  const std::size_t size = (n_megabytes << 20) / sizeof(double);
+  exec::static_thread_pool pool{n_threads};
+
+  // Allocate without value-initializing, so that no page is touched before initialization.
+  std::unique_ptr<double[]> serial{new double[size]};
+  for (std::size_t i = 0; i < size; ++i) {
+    serial[i] = 1.0;
+  }
+  std::unique_ptr<double[]> local{new double[size]};
+  ex::sync_wait(
+    exec::numa_first_touch(pool.get_scheduler(), size, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        local[i] = 1.0;
+      }
+    }));
+
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    std::cout << "serial initialization: " << measure(pool, serial.get(), size) << " GB/s"
+              << ", numa_first_touch: " << measure(pool, local.get(), size) << " GB/s" << '\n';
+  }
+}
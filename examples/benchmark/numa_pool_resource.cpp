@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the cost of allocating and freeing the task storage of a bulk operation, once with
+// the global heap, once with numa_allocator, which goes to the operating system for every
+// allocation when NUMA support is enabled, and once with numa_pool_resource. Then measures a
+// bulk operation on a static_thread_pool, which allocates its tasks from the pool's resource.
+//
+// Usage: example.benchmark.numa_pool_resource [n_operations]
+
+#include <exec/numa_pool_resource.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+
+namespace ex = stdexec;
+
+namespace {
+  //! About the size of the tasks of a bulk operation on a pool with 16 threads.
+  constexpr std::size_t block_size = 16 * 4 * sizeof(void*);
+
+  template <class Fn>
+  auto measure(std::size_t n_operations, Fn fn) -> double {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count()
+         / static_cast<double>(n_operations);
+  }
+
+  void run(exec::static_thread_pool& pool, std::size_t n_operations) {
+    double heap = measure(n_operations, [] {
+      void* p = ::operator new(block_size);
+      ::operator delete(p, block_size);
+    });
+    double numa = measure(n_operations, [] {
+      exec::numa_allocator<std::byte> alloc{0};
+      alloc.deallocate(alloc.allocate(block_size), block_size);
+    });
+    exec::numa_pool_resource resource{0};
+    double pooled = measure(n_operations, [&] {
+      resource.deallocate(resource.allocate(block_size), block_size);
+    });
+    auto sched = pool.get_scheduler();
+    double bulk = measure(n_operations / 10, [&] {
+      ex::sync_wait(ex::schedule(sched) | ex::bulk(ex::par, 64, [](std::size_t) noexcept { }));
+    });
+    std::cout << "operator new: " << heap << " ns"
+              << ", numa_allocator: " << numa << " ns"
+              << ", numa_pool_resource: " << pooled << " ns"
+              << ", bulk: " << bulk << " ns" << '\n';
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_operations = 1'000'000;
+  if (argc > 1) {
+    n_operations = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+
+  exec::static_thread_pool pool{};
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    run(pool, n_operations);
+  }
+}
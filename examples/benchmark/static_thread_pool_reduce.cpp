@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares exec::reduce on a static_thread_pool with std::reduce(std::execution::par).
+//
+// Usage: example.benchmark.static_thread_pool_reduce [n_items] [n_threads]
+
+#include <exec/reduce.hpp>
+#include <exec/static_thread_pool.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <execution>
+#include <iostream>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+  template <class Fn>
+  auto measure(Fn fn, double& result) -> double {
+    auto start = std::chrono::steady_clock::now();
+    result = fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_items = 100'000'000;
+  std::uint32_t n_threads = std::thread::hardware_concurrency();
+  if (argc > 1) {
+    n_items = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+  if (argc > 2) {
+    n_threads = static_cast<std::uint32_t>(std::atoi(argv[2]));
+  }
+
+  std::vector<double> values(n_items);
+  std::iota(values.begin(), values.end(), 0.0);
+
+  exec::static_thread_pool pool{n_threads};
+  auto reduce_on_pool = [&] {
+    auto sndr = stdexec::schedule(pool.get_scheduler())
+              | stdexec::then([&] { return std::span<const double>{values}; })
+              | exec::reduce(0.0);
+    return std::get<0>(stdexec::sync_wait(std::move(sndr)).value());
+  };
+  auto reduce_par = [&] {
+    return std::reduce(std::execution::par, values.begin(), values.end(), 0.0);
+  };
+  auto reduce_seq = [&] {
+    return std::reduce(std::execution::seq, values.begin(), values.end(), 0.0);
+  };
+
+  constexpr int n_runs = 10;
+  for (int i = 0; i < n_runs; ++i) {
+    double pool_result{};
+    double par_result{};
+    double seq_result{};
+    double pool_ms = measure(reduce_on_pool, pool_result);
+    double par_ms = measure(reduce_par, par_result);
+    double seq_ms = measure(reduce_seq, seq_result);
+    std::cout << "items: " << n_items << ", threads: " << n_threads
+              << ", exec::reduce: " << pool_ms << " ms"
+              << ", std::reduce(par): " << par_ms << " ms"
+              << ", std::reduce(seq): " << seq_ms << " ms" << '\n';
+    if (pool_result != par_result && pool_result != seq_result) {
+      std::cerr << "mismatch: " << pool_result << " != " << seq_result << '\n';
+    }
+  }
+}
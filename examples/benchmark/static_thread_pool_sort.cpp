@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares exec::sort on a static_thread_pool with std::sort, for integers (which are radix
+// sorted within each block) and for doubles (which are not).
+//
+// Usage: example.benchmark.static_thread_pool_sort [n_items] [n_threads]
+
+#include <exec/sort.hpp>
+#include <exec/static_thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+  template <class Fn>
+  auto measure(Fn fn) -> double {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+  }
+
+  template <class Ty>
+  void run(const char* name, exec::static_thread_pool& pool, std::size_t n_items) {
+    std::mt19937_64 gen{42};
+    std::vector<Ty> input(n_items);
+    for (auto& value: input) {
+      value = static_cast<Ty>(gen());
+    }
+
+    constexpr int n_runs = 10;
+    for (int i = 0; i < n_runs; ++i) {
+      std::vector<Ty> on_pool = input;
+      std::vector<Ty> sequential = input;
+      double pool_ms = measure([&] {
+        auto sndr = stdexec::schedule(pool.get_scheduler())
+                  | stdexec::then([&] { return std::span<Ty>{on_pool}; }) | exec::sort();
+        stdexec::sync_wait(std::move(sndr));
+      });
+      double seq_ms = measure([&] { std::sort(sequential.begin(), sequential.end()); });
+      std::cout << name << ": items: " << n_items << ", threads: " << pool.available_parallelism()
+                << ", exec::sort: " << pool_ms << " ms"
+                << ", std::sort: " << seq_ms << " ms" << '\n';
+      if (on_pool != sequential) {
+        std::cerr << "mismatch\n";
+      }
+    }
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_items = 10'000'000;
+  std::uint32_t n_threads = std::thread::hardware_concurrency();
+  if (argc > 1) {
+    n_items = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+  if (argc > 2) {
+    n_threads = static_cast<std::uint32_t>(std::atoi(argv[2]));
+  }
+
+  exec::static_thread_pool pool{n_threads};
+  run<std::int64_t>("int64", pool, n_items);
+  run<double>("double", pool, n_items);
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the cost of the basic stop token operations, and of a when_all whose children
+// register stop callbacks, once with a receiver that can never be stopped and once with a
+// receiver whose stop token can be stopped. In the first case, when_all knows that stop cannot
+// be requested and gives its children a token for which registering a callback is free.
+//
+// Usage: example.benchmark.stop_token [n_operations]
+
+#include <stdexec/execution.hpp>
+#include <stdexec/stop_token.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+namespace ex = stdexec;
+
+namespace {
+  struct on_stop {
+    void operator()() const noexcept {
+    }
+  };
+
+  template <class Token>
+  struct sink_receiver {
+    using receiver_concept = ex::receiver_t;
+
+    void set_value(int lhs, int rhs) noexcept {
+      *sum_ += lhs + rhs;
+    }
+
+    void set_stopped() noexcept {
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+      std::terminate();
+    }
+
+    auto get_env() const noexcept {
+      return ex::prop{ex::get_stop_token, token_};
+    }
+
+    long* sum_;
+    Token token_;
+  };
+
+  //! A child that registers a stop callback while it runs, as an I/O operation would.
+  auto observes_stop(int value) {
+    return ex::read_env(ex::get_stop_token) | ex::then([value](auto token) noexcept {
+             ex::stop_callback_for_t<decltype(token), on_stop> callback{token, on_stop{}};
+             return value;
+           });
+  }
+
+  template <class Fn>
+  auto measure(std::size_t n_operations, Fn fn) -> double {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_operations; ++i) {
+      fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count()
+         / static_cast<double>(n_operations);
+  }
+
+  template <class Token>
+  auto when_all_of_observers(std::size_t n_operations, Token token) -> double {
+    long sum = 0;
+    double ns = measure(n_operations, [&] {
+      auto op = ex::connect(
+        ex::when_all(observes_stop(1), observes_stop(2)),
+        sink_receiver<Token>{&sum, token});
+      ex::start(op);
+    });
+    if (sum != static_cast<long>(3 * n_operations)) {
+      std::cerr << "mismatch: " << sum << '\n';
+    }
+    return ns;
+  }
+
+  void run(std::size_t n_operations) {
+    ex::inplace_stop_source source;
+
+    double registered = measure(n_operations, [&] {
+      ex::inplace_stop_callback<on_stop> callback{source.get_token(), on_stop{}};
+    });
+    double sourceless = measure(n_operations, [&] {
+      ex::inplace_stop_callback<on_stop> callback{ex::inplace_stop_token{}, on_stop{}};
+    });
+    double never = measure(n_operations, [&] {
+      using callback_t = ex::stop_callback_for_t<ex::never_stop_token, on_stop>;
+      callback_t callback{ex::never_stop_token{}, on_stop{}};
+    });
+    double request_stop = measure(n_operations, [&] {
+      ex::inplace_stop_source local;
+      local.request_stop();
+    });
+    double request_stop_one = measure(n_operations, [&] {
+      ex::inplace_stop_source local;
+      ex::inplace_stop_callback<on_stop> callback{local.get_token(), on_stop{}};
+      local.request_stop();
+    });
+    double unstoppable_chain = when_all_of_observers(n_operations, ex::never_stop_token{});
+    double stoppable_chain = when_all_of_observers(n_operations, source.get_token());
+
+    std::cout << "callback (registered): " << registered << " ns"
+              << ", callback (no source): " << sourceless << " ns"
+              << ", callback (never_stop_token): " << never << " ns"
+              << ", request_stop: " << request_stop << " ns"
+              << ", request_stop (1 callback): " << request_stop_one << " ns"
+              << ", when_all (never_stop_token): " << unstoppable_chain << " ns"
+              << ", when_all (inplace_stop_token): " << stoppable_chain << " ns"
+              << '\n';
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_operations = 10'000'000;
+  if (argc > 1) {
+    n_operations = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    run(n_operations);
+  }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how long an exec::task running on a static_thread_pool takes to co_await a sender
+// that completes on the same pool. When the sender reports the pool as its completion
+// scheduler, the task resumes where the sender completes. When it hides its completion
+// scheduler, the task has to schedule itself back onto the pool after every co_await, which
+// is what it did for every sender before.
+//
+// Usage: example.benchmark.task_reschedule [n_awaits]
+
+#include <exec/static_thread_pool.hpp>
+#include <exec/task.hpp>
+#include <stdexec/execution.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+namespace ex = stdexec;
+
+namespace {
+  //! Forwards to the wrapped sender but reports no completion scheduler.
+  template <class Sender>
+  struct opaque_sender {
+    using sender_concept = ex::sender_t;
+
+    template <class Env>
+    auto get_completion_signatures(Env&&) const -> ex::completion_signatures_of_t<Sender, Env> {
+      return {};
+    }
+
+    template <ex::receiver Receiver>
+    auto connect(Receiver rcvr) && -> ex::connect_result_t<Sender, Receiver> {
+      return ex::connect(std::move(sndr_), std::move(rcvr));
+    }
+
+    Sender sndr_;
+  };
+
+  template <class Sender>
+  opaque_sender(Sender) -> opaque_sender<Sender>;
+
+  auto await_loop(exec::static_thread_pool::scheduler sched, std::size_t n_awaits, bool opaque)
+    -> exec::task<long> {
+    long sum = 0;
+    for (std::size_t i = 0; i < n_awaits; ++i) {
+      auto sndr = ex::schedule(sched) | ex::then([i] { return static_cast<long>(i); });
+      if (opaque) {
+        sum += co_await opaque_sender{std::move(sndr)};
+      } else {
+        sum += co_await std::move(sndr);
+      }
+    }
+    co_return sum;
+  }
+
+  auto measure(exec::static_thread_pool& pool, std::size_t n_awaits, bool opaque) -> double {
+    auto sched = pool.get_scheduler();
+    auto start = std::chrono::steady_clock::now();
+    auto [sum] = ex::sync_wait(ex::starts_on(sched, await_loop(sched, n_awaits, opaque))).value();
+    auto end = std::chrono::steady_clock::now();
+    if (sum != static_cast<long>(n_awaits * (n_awaits - 1) / 2)) {
+      std::cerr << "mismatch: " << sum << '\n';
+    }
+    return std::chrono::duration<double, std::nano>(end - start).count()
+         / static_cast<double>(n_awaits);
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_awaits = 1'000'000;
+  if (argc > 1) {
+    n_awaits = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+
+  exec::static_thread_pool pool{1};
+  constexpr int n_runs = 5;
+  for (int i = 0; i < n_runs; ++i) {
+    double elided = measure(pool, n_awaits, false);
+    double rescheduled = measure(pool, n_awaits, true);
+    std::cout << "co_await on the same pool: " << elided << " ns"
+              << ", with a reschedule: " << rescheduled << " ns" << '\n';
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares fanning out to a runtime-sized set of shards on a static_thread_pool with
+// exec::when_all_range against spawning each shard in an exec::async_scope and summing the
+// results with an atomic counter.
+//
+// Usage: example.benchmark.when_all_range [n_fan_outs] [n_threads]
+
+#include <exec/async_scope.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <exec/when_all_range.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  auto shard(exec::static_thread_pool::scheduler sched, long index) {
+    return ex::starts_on(sched, ex::just(index) | ex::then([](long i) { return i * i; }));
+  }
+
+  template <class Fn>
+  auto measure(std::size_t n_fan_outs, Fn fn) -> double {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_fan_outs; ++i) {
+      fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count()
+         / static_cast<double>(n_fan_outs);
+  }
+
+  void run(exec::static_thread_pool& pool, std::size_t n_fan_outs, long n_shards) {
+    auto sched = pool.get_scheduler();
+    const long expected = (n_shards - 1) * n_shards * (2 * n_shards - 1) / 6;
+    long range_sum = 0;
+    long scope_sum = 0;
+
+    double range_us = measure(n_fan_outs, [&] {
+      std::vector<decltype(shard(sched, 0))> shards;
+      shards.reserve(static_cast<std::size_t>(n_shards));
+      for (long i = 0; i < n_shards; ++i) {
+        shards.push_back(shard(sched, i));
+      }
+      auto [sum] =
+        ex::sync_wait(exec::when_all_range(std::move(shards), 0L, std::plus<>{})).value();
+      range_sum = sum;
+    });
+
+    double scope_us = measure(n_fan_outs, [&] {
+      exec::async_scope scope;
+      std::atomic<long> sum{0};
+      for (long i = 0; i < n_shards; ++i) {
+        scope.spawn(shard(sched, i) | ex::then([&sum](long value) {
+                      sum.fetch_add(value, std::memory_order_relaxed);
+                    }));
+      }
+      ex::sync_wait(scope.on_empty());
+      scope_sum = sum.load();
+    });
+
+    std::cout << "shards: " << n_shards << ", threads: " << pool.available_parallelism()
+              << ", when_all_range: " << range_us << " us"
+              << ", async_scope: " << scope_us << " us" << '\n';
+    if (range_sum != expected || scope_sum != expected) {
+      std::cerr << "mismatch\n";
+    }
+  }
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+  std::size_t n_fan_outs = 10'000;
+  std::uint32_t n_threads = std::thread::hardware_concurrency();
+  if (argc > 1) {
+    n_fan_outs = static_cast<std::size_t>(std::atoll(argv[1]));
+  }
+  if (argc > 2) {
+    n_threads = static_cast<std::uint32_t>(std::atoi(argv[2]));
+  }
+
+  exec::static_thread_pool pool{n_threads};
+  for (long n_shards: {1L, 8L, 64L, 512L}) {
+    run(pool, n_fan_outs, n_shards);
+  }
+}
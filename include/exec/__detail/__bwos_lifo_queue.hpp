@@ -19,6 +19,7 @@
 #include "../../stdexec/__detail/__config.hpp"
 #include "../../stdexec/__detail/__spin_loop_pause.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <bit>
 #include <cstddef>
@@ -67,6 +68,12 @@ namespace exec::bwos {
 
     auto steal_front() noexcept -> Tp;
 
+    //! Steals the tasks of the oldest stealable block in a single step, but at most `max_count`
+    //! of them, and writes them to `out` from the oldest to the newest. Returns the end of the
+    //! written range, which is `out` if there was nothing to steal.
+    template <class OutputIterator>
+    auto steal_block(OutputIterator out, std::size_t max_count) noexcept -> OutputIterator;
+
     auto push_back(Tp value) noexcept -> bool;
 
     template <class Iterator, class Sentinel>
@@ -104,6 +111,10 @@ namespace exec::bwos {
 
       auto steal() noexcept -> fetch_result<Tp>;
 
+      template <class OutputIterator>
+      auto steal_many(OutputIterator out, std::size_t max_count) noexcept
+        -> fetch_result<OutputIterator>;
+
       auto takeover() noexcept -> takeover_result;
       [[nodiscard]]
       auto is_writable() const noexcept -> bool;
@@ -191,6 +202,32 @@ namespace exec::bwos {
     return Tp{};
   }
 
+  template <class Tp, class Allocator>
+  template <class OutputIterator>
+  auto lifo_queue<Tp, Allocator>::steal_block(OutputIterator out, std::size_t max_count) noexcept
+    -> OutputIterator {
+    if (max_count == 0) {
+      return out;
+    }
+    std::size_t thief = 0;
+    do {
+      thief = thief_block_.load(std::memory_order_relaxed);
+      std::size_t thief_index = thief & mask_;
+      block_type &block = blocks_[thief_index];
+      fetch_result result = block.steal_many(out, max_count);
+      while (result.status != lifo_queue_error_code::done) {
+        if (result.status == lifo_queue_error_code::success) {
+          return result.value;
+        }
+        if (result.status == lifo_queue_error_code::empty) {
+          return out;
+        }
+        result = block.steal_many(out, max_count);
+      }
+    } while (advance_steal_index(thief));
+    return out;
+  }
+
   template <class Tp, class Allocator>
   auto lifo_queue<Tp, Allocator>::push_back(Tp value) noexcept -> bool {
     do {
@@ -412,6 +449,37 @@ namespace exec::bwos {
     return result;
   }
 
+  // Like steal(), but claims all stealable slots of the block up to `max_count` with one
+  // compare-exchange, which races with the owner's takeover() in the same way.
+  template <class Tp, class Allocator>
+  template <class OutputIterator>
+  auto lifo_queue<Tp, Allocator>::block_type::steal_many(
+    OutputIterator out,
+    std::size_t max_count) noexcept -> fetch_result<OutputIterator> {
+    std::uint64_t spos = steal_tail_.load(std::memory_order_relaxed);
+    fetch_result<OutputIterator> result{lifo_queue_error_code::success, out};
+    if (spos == block_size()) [[unlikely]] {
+      result.status = lifo_queue_error_code::done;
+      return result;
+    }
+    std::uint64_t back = tail_.load(std::memory_order_acquire);
+    if (spos == back) [[unlikely]] {
+      result.status = lifo_queue_error_code::empty;
+      return result;
+    }
+    std::uint64_t count = std::min<std::uint64_t>(back - spos, max_count);
+    if (!steal_tail_.compare_exchange_strong(spos, spos + count, std::memory_order_relaxed)) {
+      result.status = lifo_queue_error_code::conflict;
+      return result;
+    }
+    for (std::uint64_t i = spos; i < spos + count; ++i) {
+      *result.value = static_cast<Tp &&>(ring_buffer_[static_cast<std::size_t>(i)]);
+      ++result.value;
+    }
+    steal_head_.fetch_add(count, std::memory_order_release);
+    return result;
+  }
+
   template <class Tp, class Allocator>
   auto lifo_queue<Tp, Allocator>::block_type::takeover() noexcept -> takeover_result {
     std::uint64_t spos = steal_tail_.exchange(block_size(), std::memory_order_relaxed);
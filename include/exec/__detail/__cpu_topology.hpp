@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <algorithm> // IWYU pragma: keep
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+namespace exec {
+  //! Where a CPU is in the cache and core hierarchy of the host. CPUs are identified by the
+  //! number that the operating system gives them. A core and a last-level cache are identified
+  //! by the lowest numbered CPU that shares them; -1 means unknown.
+  struct cpu_info {
+    int cpu;
+    int core;
+    int l3;
+    int node;
+
+    friend auto operator==(const cpu_info&, const cpu_info&) noexcept -> bool = default;
+  };
+
+  //! The CPUs of the host in the order of their numbers, as far as they are known.
+  class cpu_topology {
+   public:
+    cpu_topology() = default;
+
+    explicit cpu_topology(std::vector<cpu_info> cpus)
+      : cpus_(std::move(cpus)) {
+      // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
+      std::sort(cpus_.begin(), cpus_.end(), [](const cpu_info& lhs, const cpu_info& rhs) {
+        return lhs.cpu < rhs.cpu;
+      });
+    }
+
+    //! Reads the topology of the online CPUs from a directory that is laid out like Linux's
+    //! `/sys/devices/system/cpu`. Returns an empty topology if the directory does not exist.
+    static auto from_sysfs(const std::filesystem::path& root = "/sys/devices/system/cpu")
+      -> cpu_topology {
+      std::vector<cpu_info> cpus;
+      for (int cpu: read_cpu_list(root / "online")) {
+        const std::filesystem::path dir = root / ("cpu" + std::to_string(cpu));
+        cpu_info info{.cpu = cpu, .core = cpu, .l3 = -1, .node = 0};
+        if (auto siblings = read_cpu_list(dir / "topology" / "thread_siblings_list");
+            !siblings.empty()) {
+          info.core = siblings.front();
+        }
+        for (int index = 0;; ++index) {
+          const std::filesystem::path cache = dir / "cache" / ("index" + std::to_string(index));
+          std::ifstream level{cache / "level"};
+          int value = 0;
+          if (!(level >> value)) {
+            break;
+          }
+          if (value == 3) {
+            if (auto shared = read_cpu_list(cache / "shared_cpu_list"); !shared.empty()) {
+              info.l3 = shared.front();
+            }
+            break;
+          }
+        }
+        std::error_code ec;
+        for (const auto& entry: std::filesystem::directory_iterator{dir, ec}) {
+          const std::string name = entry.path().filename().string();
+          if (name.starts_with("node") && name.size() > 4) {
+            info.node = std::atoi(name.c_str() + 4);
+            break;
+          }
+        }
+        cpus.push_back(info);
+      }
+      return cpu_topology{std::move(cpus)};
+    }
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+      return cpus_.empty();
+    }
+
+    [[nodiscard]]
+    auto cpus() const noexcept -> std::span<const cpu_info> {
+      return cpus_;
+    }
+
+    //! Returns the CPUs of a NUMA node, or all CPUs if none is known to belong to the node.
+    [[nodiscard]]
+    auto cpus_of_node(int node) const -> std::vector<cpu_info> {
+      std::vector<cpu_info> result;
+      for (const cpu_info& info: cpus_) {
+        if (info.node == node) {
+          result.push_back(info);
+        }
+      }
+      return result.empty() ? cpus_ : result;
+    }
+
+    //! Parses a list of CPUs in the format of the Linux kernel, such as `0-3,8,10-11`.
+    static auto parse_cpu_list(const std::string& list) -> std::vector<int> {
+      std::vector<int> cpus;
+      std::size_t pos = 0;
+      while (pos < list.size()) {
+        std::size_t end = list.find(',', pos);
+        if (end == std::string::npos) {
+          end = list.size();
+        }
+        const std::string range = list.substr(pos, end - pos);
+        if (!range.empty() && range.front() != '\n') {
+          const std::size_t dash = range.find('-');
+          const int first = std::atoi(range.c_str());
+          const int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+          for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+          }
+        }
+        pos = end + 1;
+      }
+      return cpus;
+    }
+
+   private:
+    static auto read_cpu_list(const std::filesystem::path& path) -> std::vector<int> {
+      std::ifstream file{path};
+      std::string list;
+      if (!std::getline(file, list)) {
+        return {};
+      }
+      return parse_cpu_list(list);
+    }
+
+    std::vector<cpu_info> cpus_;
+  };
+
+  //! How close a thread that tries to steal work is to the thread that it steals from. Thieves
+  //! look for work in rings of victims that widen from one level to the next.
+  enum class steal_level : std::uint8_t {
+    smt,    //!< on the same core
+    cache,  //!< sharing the last-level cache
+    node,   //!< on the same NUMA node
+    remote, //!< anywhere
+  };
+
+  inline constexpr std::size_t steal_level_count = 4;
+
+  //! Returns the closest level at which a thread on CPU `thief` reaches a thread on CPU `victim`,
+  //! without looking at NUMA nodes.
+  inline auto cpu_steal_level(const cpu_info& thief, const cpu_info& victim) noexcept
+    -> steal_level {
+    if (thief.core >= 0 && thief.core == victim.core) {
+      return steal_level::smt;
+    }
+    if (thief.l3 >= 0 && thief.l3 == victim.l3) {
+      return steal_level::cache;
+    }
+    return steal_level::remote;
+  }
+
+  namespace __topology {
+    using __steal_rings_t = std::array<std::vector<std::uint32_t>, steal_level_count>;
+
+    //! Sorts the other threads of a pool into the rings in which thread `__self` looks for
+    //! work, where thread `__i` runs on `__thread_cpus[__i]`. Each ring contains the threads of
+    //! all closer rings, so that a thief that exhausts one ring tries the next wider one.
+    inline auto __steal_rings(std::span<const cpu_info> __thread_cpus, std::uint32_t __self)
+      -> __steal_rings_t {
+      __steal_rings_t __rings{};
+      const cpu_info& __thief = __thread_cpus[__self];
+      for (std::uint32_t __i = 0; __i < __thread_cpus.size(); ++__i) {
+        if (__i == __self) {
+          continue;
+        }
+        const cpu_info& __victim = __thread_cpus[__i];
+        steal_level __level = steal_level::remote;
+        if (__victim.node == __thief.node) {
+          __level = steal_level::node;
+          if (__thief.cpu >= 0 && __victim.cpu >= 0) {
+            __level = std::min(__level, cpu_steal_level(__thief, __victim));
+          }
+        }
+        for (auto __ring = static_cast<std::size_t>(__level); __ring < steal_level_count;
+             ++__ring) {
+          __rings[__ring].push_back(__i);
+        }
+      }
+      return __rings;
+    }
+
+    //! Whether a thief skips the ring at `__level` because it is empty, or because it contains
+    //! the same threads as the node ring, which the thief tries later anyway.
+    template <class _Ring>
+    auto __skips_steal_ring(
+      const std::array<_Ring, steal_level_count>& __rings,
+      std::size_t __level) noexcept -> bool {
+      const auto __node = static_cast<std::size_t>(steal_level::node);
+      return __rings[__level].empty()
+          || (__level < __node && __rings[__level].size() == __rings[__node].size());
+    }
+  } // namespace __topology
+
+  //! How `static_thread_pool` places its threads on the CPUs of the host, and how hard they try
+  //! to steal work at each level of the topology before they look further away.
+  struct topology_params {
+    //! The CPUs that threads are placed on. With an empty topology, threads only distinguish
+    //! victims on their own NUMA node from all others.
+    cpu_topology topology{};
+    //! How many times a thief picks a random victim of each ring. 0 means one more than the
+    //! number of threads of the pool.
+    std::array<std::uint32_t, steal_level_count> steal_attempts{};
+    //! Whether each thread is bound to its CPU of the topology.
+    bool pin_threads{false};
+  };
+
+  //! Binds the calling thread to a CPU. Returns false if that is not supported or fails.
+  inline auto pin_this_thread_to_cpu(int cpu) noexcept -> bool {
+#if defined(__linux__)
+    ::cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<std::size_t>(cpu), &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void) cpu;
+    return false;
+#endif
+  }
+} // namespace exec
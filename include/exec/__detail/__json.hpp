@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <ostream>
+
+namespace exec::__json {
+  //! Writes a string as a JSON string literal, escaping quotes, backslashes and control
+  //! characters. A null pointer is written as an empty string.
+  inline void __write_string(std::ostream& __out, const char* __str) {
+    __out << '"';
+    for (; __str != nullptr && *__str != '\0'; ++__str) {
+      const char __c = *__str;
+      if (__c == '"' || __c == '\\') {
+        __out << '\\' << __c;
+      } else if (static_cast<unsigned char>(__c) < 0x20) {
+        constexpr const char* __hex = "0123456789abcdef";
+        __out << "\\u00" << __hex[(__c >> 4) & 0xf] << __hex[__c & 0xf];
+      } else {
+        __out << __c;
+      }
+    }
+    __out << '"';
+  }
+} // namespace exec::__json
@@ -21,11 +21,15 @@
 #include "../scope.hpp" // IWYU pragma: keep
 
 #include <algorithm> // IWYU pragma: keep
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <new> // IWYU pragma: keep
 #include <thread>
 #include <utility>
+#include <vector>
 
 // Work around a bug in the NVHPC compilers prior to version 24.03
 #if STDEXEC_NVHPC()
@@ -72,6 +76,7 @@ namespace exec {
       auto (*num_cpus)(const _storage*, int) noexcept -> std::size_t;
       auto (*bind_to_node)(const _storage*, int) noexcept -> int;
       auto (*thread_index_to_node)(const _storage*, std::size_t) noexcept -> int;
+      auto (*remote_access)(const _storage*, int, int) noexcept -> void;
     };
 
     template <class T>
@@ -139,6 +144,17 @@ namespace exec {
           return reinterpret_cast<const T*>(self->buf)->thread_index_to_node(index);
         }
       }
+
+      // remote_access, which is optional
+      static auto _remote_access(const _storage* self, int from, int to) noexcept -> void {
+        if constexpr (requires(const T& policy) { policy.remote_access(from, to); }) {
+          if constexpr (!_is_small<T>::value) {
+            static_cast<const T*>(self->ptr)->remote_access(from, to);
+          } else {
+            reinterpret_cast<const T*>(self->buf)->remote_access(from, to);
+          }
+        }
+      }
     };
 
     template <class NumaPolicy>
@@ -149,7 +165,8 @@ namespace exec {
       .num_nodes = _vtable_for<NumaPolicy>::_num_nodes,
       .num_cpus = _vtable_for<NumaPolicy>::_num_cpus,
       .bind_to_node = _vtable_for<NumaPolicy>::_bind_to_node,
-      .thread_index_to_node = _vtable_for<NumaPolicy>::_thread_index_to_node};
+      .thread_index_to_node = _vtable_for<NumaPolicy>::_thread_index_to_node,
+      .remote_access = _vtable_for<NumaPolicy>::_remote_access};
   } // namespace _numa
 
   struct numa_policy {
@@ -198,6 +215,11 @@ namespace exec {
     auto thread_index_to_node(std::size_t index) const noexcept -> int {
       return vtable_->thread_index_to_node(&storage_, index);
     }
+
+    //! Called when a thread on node `from` takes over work that was queued on node `to`.
+    void remote_access(int from, int to) const noexcept {
+      vtable_->remote_access(&storage_, from, to);
+    }
   };
 
   struct no_numa_policy {
@@ -220,6 +242,116 @@ namespace exec {
       return 0;
     }
   };
+
+  //! A NUMA policy that pretends that the host has several NUMA nodes, so that the placement
+  //! and work-stealing heuristics of `static_thread_pool` can be exercised and tuned on hosts
+  //! with a single node. Each node has a set of CPUs, and threads are assigned to nodes in the
+  //! order of their CPUs, as with `default_numa_policy`. Threads are not bound to the CPUs.
+  //!
+  //! Taking over work that was queued on another node can be made to cost an extra delay, to
+  //! imitate the cost of remote memory accesses. Copies of the policy share a count of these
+  //! remote accesses.
+  class simulated_numa_policy {
+    struct state {
+      std::vector<std::vector<int>> cpus_;
+      std::vector<std::size_t> node_to_thread_index_;
+      std::chrono::nanoseconds remote_delay_;
+      mutable std::atomic<std::size_t> remote_accesses_{0};
+    };
+
+    std::shared_ptr<const state> state_;
+
+   public:
+    //! Simulates one node for each element of `cpus`, which lists the CPUs of the node.
+    explicit simulated_numa_policy(
+      std::vector<std::vector<int>> cpus,
+      std::chrono::nanoseconds remote_delay = {})
+      : state_{[&] {
+        auto st = std::make_shared<state>();
+        std::size_t total_cpus = 0;
+        for (const std::vector<int>& node_cpus: cpus) {
+          total_cpus += node_cpus.size();
+          st->node_to_thread_index_.push_back(total_cpus);
+        }
+        STDEXEC_ASSERT(total_cpus > 0);
+        st->cpus_ = std::move(cpus);
+        st->remote_delay_ = remote_delay;
+        return st;
+      }()} {
+    }
+
+    //! Simulates `num_nodes` nodes with `cpus_per_node` consecutively numbered CPUs each.
+    simulated_numa_policy(
+      std::size_t num_nodes,
+      std::size_t cpus_per_node,
+      std::chrono::nanoseconds remote_delay = {})
+      : simulated_numa_policy(make_cpus(num_nodes, cpus_per_node), remote_delay) {
+    }
+
+    [[nodiscard]]
+    auto num_nodes() const noexcept -> std::size_t {
+      return state_->cpus_.size();
+    }
+
+    [[nodiscard]]
+    auto num_cpus(int node) const noexcept -> std::size_t {
+      return node >= 0 && static_cast<std::size_t>(node) < num_nodes()
+             ? state_->cpus_[static_cast<std::size_t>(node)].size()
+             : 0;
+    }
+
+    //! The CPUs of a simulated node.
+    [[nodiscard]]
+    auto cpus(int node) const noexcept -> const std::vector<int>& {
+      return state_->cpus_[static_cast<std::size_t>(node)];
+    }
+
+    auto bind_to_node(int) const noexcept -> int { // NOLINT(modernize-use-nodiscard)
+      return 0;
+    }
+
+    [[nodiscard]]
+    auto thread_index_to_node(std::size_t index) const noexcept -> int {
+      const std::vector<std::size_t>& node_to_thread_index = state_->node_to_thread_index_;
+      index %= node_to_thread_index.back();
+      // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
+      auto it = std::upper_bound(node_to_thread_index.begin(), node_to_thread_index.end(), index);
+      return static_cast<int>(std::distance(node_to_thread_index.begin(), it));
+    }
+
+    void remote_access(int from, int to) const noexcept {
+      if (from == to) {
+        return;
+      }
+      state_->remote_accesses_.fetch_add(1, std::memory_order_relaxed);
+      if (state_->remote_delay_.count() > 0) {
+        // Spin rather than sleep, since the delays of interest are far below the resolution of
+        // the operating system's timers.
+        auto until = std::chrono::steady_clock::now() + state_->remote_delay_;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+      }
+    }
+
+    //! The number of times that work queued on one node was taken over by a thread of another.
+    [[nodiscard]]
+    auto remote_accesses() const noexcept -> std::size_t {
+      return state_->remote_accesses_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    static auto make_cpus(std::size_t num_nodes, std::size_t cpus_per_node)
+      -> std::vector<std::vector<int>> {
+      std::vector<std::vector<int>> cpus(num_nodes);
+      int cpu = 0;
+      for (std::vector<int>& node_cpus: cpus) {
+        for (std::size_t i = 0; i < cpus_per_node; ++i) {
+          node_cpus.push_back(cpu++);
+        }
+      }
+      return cpus;
+    }
+  };
 } // namespace exec
 
 #if STDEXEC_ENABLE_NUMA
@@ -419,10 +551,12 @@ namespace exec {
     friend auto operator==(const numa_allocator&, const numa_allocator&) noexcept -> bool = default;
   };
 
+  //! Without NUMA support there is only one real node, but a `simulated_numa_policy` can make
+  //! a pool spread its threads over up to 64 nodes.
   class nodemask {
     static auto make_any() noexcept -> nodemask {
       nodemask mask;
-      mask.mask_ = true;
+      mask.mask_ = ~std::uint64_t{0};
       return mask;
     }
 
@@ -435,11 +569,13 @@ namespace exec {
     }
 
     auto operator[](std::size_t nodemask) const noexcept -> bool {
-      return mask_ && nodemask == 0;
+      return nodemask < 64 && ((mask_ >> nodemask) & 1u) != 0;
     }
 
     void set(std::size_t nodemask) noexcept {
-      mask_ |= nodemask == 0;
+      if (nodemask < 64) {
+        mask_ |= std::uint64_t{1} << nodemask;
+      }
     }
 
     friend auto operator==(const nodemask& lhs, const nodemask& rhs) noexcept -> bool {
@@ -447,7 +583,7 @@ namespace exec {
     }
 
    private:
-    bool mask_{false};
+    std::uint64_t mask_{0};
   };
 } // namespace exec
 #endif
\ No newline at end of file
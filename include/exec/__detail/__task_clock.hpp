@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+#include "./__trace.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+// Schedulers note when a thread begins to run a task, so that `exec::instrument` can tell how
+// long the work of a sender waited in a queue before it ran. The clock is only read while a
+// `latency_sink` is enabled.
+
+namespace exec::__task_clock {
+  inline std::atomic<std::uint32_t> __n_enabled{0};
+
+  inline thread_local std::uint64_t __task_begin_ns = 0;
+
+  STDEXEC_ATTRIBUTE((always_inline)) void __note_task_begin() noexcept {
+    if (__n_enabled.load(std::memory_order_relaxed) != 0) [[unlikely]] {
+      __task_begin_ns = __trace::__now_ns();
+    }
+  }
+} // namespace exec::__task_clock
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <algorithm> // IWYU pragma: keep
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// The schedulers of this library record what they do into per-thread ring buffers while
+// tracing is started. A stopped trace costs one relaxed load of a global flag per event.
+
+namespace exec {
+  //! What happened at a point of a trace.
+  enum class trace_event : std::uint8_t {
+    enqueue,    //!< a task was queued; the argument is the index of the target thread
+    dequeue,    //!< a thread took a task to run it; the argument is the index of its queue
+    steal,      //!< a thread stole tasks; the argument is the index of the victim thread
+    sleep,      //!< a thread went to sleep because it found no work
+    wake,       //!< a sleeping thread woke up
+    timer,      //!< a timer fired; the argument is how late it fired in nanoseconds
+    submit,     //!< operations were submitted to the kernel; the argument is their number
+    complete,   //!< completions were reaped from the kernel; the argument is their number
+    span_begin, //!< a traced sender was started; the argument identifies the span
+    span_end,   //!< a traced sender completed; the argument identifies the span
+  };
+
+  //! One event of a trace. `name` points to a string with static storage duration.
+  struct trace_record {
+    std::uint64_t time_ns;
+    const char* name;
+    std::uint64_t arg;
+    std::uint32_t thread;
+    trace_event event;
+  };
+
+  namespace __trace {
+    inline std::atomic<bool> __enabled{false};
+
+    inline auto __now_ns() noexcept -> std::uint64_t {
+      return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+    }
+
+    //! A ring buffer that one thread writes to while others may read it. The oldest events are
+    //! overwritten when it is full. Every slot is guarded by a sequence number, so that readers
+    //! can tell a torn slot from a complete one without blocking the writer.
+    class __buffer {
+      struct __slot {
+        std::atomic<std::uint64_t> __seq_{0};
+        std::atomic<std::uint64_t> __time_{0};
+        std::atomic<const char*> __name_{nullptr};
+        std::atomic<std::uint64_t> __arg_{0};
+        std::atomic<trace_event> __event_{};
+      };
+
+     public:
+      __buffer(std::size_t __capacity, std::uint32_t __thread_index)
+        : __mask_(__rounded_capacity(__capacity) - 1)
+        , __slots_(std::make_unique<__slot[]>(__mask_ + 1))
+        , __thread_(__thread_index) {
+      }
+
+      static auto __rounded_capacity(std::size_t __capacity) noexcept -> std::size_t {
+        return std::bit_ceil(std::max<std::size_t>(__capacity, 2));
+      }
+
+      [[nodiscard]]
+      auto __capacity() const noexcept -> std::size_t {
+        return __mask_ + 1;
+      }
+
+      void __push(trace_event __event, const char* __name, std::uint64_t __arg) noexcept {
+        const std::uint64_t __head = __head_.load(std::memory_order_relaxed);
+        __slot& __s = __slots_[__head & __mask_];
+        __s.__seq_.store(2 * __head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        __s.__time_.store(__now_ns(), std::memory_order_relaxed);
+        __s.__name_.store(__name, std::memory_order_relaxed);
+        __s.__arg_.store(__arg, std::memory_order_relaxed);
+        __s.__event_.store(__event, std::memory_order_relaxed);
+        __s.__seq_.store(2 * __head + 2, std::memory_order_release);
+        __head_.store(__head + 1, std::memory_order_release);
+      }
+
+      //! Appends the events that are still in the buffer and happened at or after `__since`.
+      void __collect(std::vector<trace_record>& __out, std::uint64_t __since) const {
+        const std::uint64_t __head = __head_.load(std::memory_order_acquire);
+        const std::uint64_t __size = __mask_ + 1;
+        for (std::uint64_t __i = __head > __size ? __head - __size : 0; __i < __head; ++__i) {
+          const __slot& __s = __slots_[__i & __mask_];
+          const std::uint64_t __seq = __s.__seq_.load(std::memory_order_acquire);
+          trace_record __record{
+            .time_ns = __s.__time_.load(std::memory_order_relaxed),
+            .name = __s.__name_.load(std::memory_order_relaxed),
+            .arg = __s.__arg_.load(std::memory_order_relaxed),
+            .thread = __thread_,
+            .event = __s.__event_.load(std::memory_order_relaxed)};
+          std::atomic_thread_fence(std::memory_order_acquire);
+          if (__seq != 2 * __i + 2 || __s.__seq_.load(std::memory_order_relaxed) != __seq) {
+            continue; // The writer has overwritten this slot in the meantime.
+          }
+          if (__record.time_ns >= __since) {
+            __out.push_back(__record);
+          }
+        }
+      }
+
+     private:
+      std::uint64_t __mask_;
+      std::unique_ptr<__slot[]> __slots_;
+      std::uint32_t __thread_;
+      alignas(64) std::atomic<std::uint64_t> __head_{0};
+    };
+
+    //! Owns the buffers of all threads that recorded events. When a thread exits, its buffer
+    //! is kept idle, so that its events can still be collected and the next thread that records
+    //! its first event reuses it instead of allocating a new one, and records under the index
+    //! of the exited thread. Only `__max_idle_buffers` idle buffers are kept; the buffers of
+    //! further threads are freed when they exit.
+    class __registry {
+     public:
+      static constexpr std::size_t __max_idle_buffers = 16;
+
+      __registry() {
+        __idle_.reserve(__max_idle_buffers);
+      }
+
+      //! Returns an idle buffer of the current capacity, or a new one.
+      auto __acquire() -> __buffer* {
+        std::scoped_lock __lock{__mutex_};
+        while (!__idle_.empty()) {
+          __buffer* __buf = __idle_.back();
+          __idle_.pop_back();
+          if (__buf->__capacity() == __buffer::__rounded_capacity(__capacity_)) {
+            return __buf;
+          }
+          __erase(__buf);
+        }
+        return __buffers_
+          .emplace_back(std::make_unique<__buffer>(__capacity_, __next_thread_index_++))
+          .get();
+      }
+
+      //! Takes back the buffer of an exiting thread.
+      void __release(__buffer* __buf) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        if (__idle_.size() < __max_idle_buffers) {
+          __idle_.push_back(__buf); // does not allocate, see the constructor
+        } else {
+          __erase(__buf);
+        }
+      }
+
+      //! Frees the idle buffers and sets the capacity of the buffers of threads that record
+      //! their first event afterwards. Events that were recorded before are no longer collected.
+      void __clear(std::size_t __capacity) noexcept {
+        std::scoped_lock __lock{__mutex_};
+        for (__buffer* __buf: __idle_) {
+          __erase(__buf);
+        }
+        __idle_.clear();
+        __capacity_ = __capacity;
+        __since_.store(__now_ns(), std::memory_order_relaxed);
+      }
+
+      void __collect(std::vector<trace_record>& __out) {
+        const std::uint64_t __since = __since_.load(std::memory_order_relaxed);
+        std::scoped_lock __lock{__mutex_};
+        for (const auto& __buf: __buffers_) {
+          __buf->__collect(__out, __since);
+        }
+      }
+
+      [[nodiscard]]
+      auto __buffer_count() -> std::size_t {
+        std::scoped_lock __lock{__mutex_};
+        return __buffers_.size();
+      }
+
+     private:
+      void __erase(__buffer* __buf) noexcept {
+        std::erase_if(__buffers_, [__buf](const auto& __b) { return __b.get() == __buf; });
+      }
+
+      std::mutex __mutex_;
+      std::vector<std::unique_ptr<__buffer>> __buffers_;
+      std::vector<__buffer*> __idle_;
+      std::size_t __capacity_{std::size_t{1} << 14u};
+      std::uint32_t __next_thread_index_{0};
+      std::atomic<std::uint64_t> __since_{0};
+    };
+
+    inline auto __get_registry() -> __registry& {
+      static __registry __instance;
+      return __instance;
+    }
+
+    //! The buffer of the calling thread. These are trivially destructible, so that they remain
+    //! usable by thread-local objects that are destroyed after `__release_at_exit`.
+    inline thread_local constinit __buffer* __tls_buffer = nullptr;
+    inline thread_local constinit bool __tls_exited = false;
+
+    //! Hands the buffer of the calling thread back to the registry when the thread exits.
+    struct __release_at_exit {
+      ~__release_at_exit() {
+        if (__tls_buffer != nullptr) {
+          __get_registry().__release(std::exchange(__tls_buffer, nullptr));
+        }
+        __tls_exited = true;
+      }
+    };
+
+    //! Returns the buffer of the calling thread, or null if the thread is exiting.
+    inline auto __this_thread_buffer() -> __buffer* {
+      if (__tls_buffer == nullptr && !__tls_exited) {
+        static thread_local __release_at_exit __release{};
+        (void) __release;
+        __tls_buffer = __get_registry().__acquire();
+      }
+      return __tls_buffer;
+    }
+
+    inline void
+      __record_slow(trace_event __event, const char* __name, std::uint64_t __arg) noexcept {
+      try {
+        if (__buffer* __buf = __this_thread_buffer()) {
+          __buf->__push(__event, __name, __arg);
+        }
+      } catch (...) {
+        // Dropping an event is better than failing the operation that it describes.
+      }
+    }
+
+    //! Records an event on the calling thread if tracing is started.
+    STDEXEC_ATTRIBUTE((always_inline)) void
+      __record(trace_event __event, const char* __name, std::uint64_t __arg = 0) noexcept {
+      if (__enabled.load(std::memory_order_relaxed)) [[unlikely]] {
+        __record_slow(__event, __name, __arg);
+      }
+    }
+  } // namespace __trace
+
+  //! Drops the events that were recorded so far and frees the buffers of threads that exited.
+  //! Threads that record their first event afterwards get buffers that hold their last
+  //! `buffer_capacity` events, rounded up to a power of two.
+  inline void clear_trace(std::size_t buffer_capacity = std::size_t{1} << 14u) noexcept {
+    __trace::__get_registry().__clear(buffer_capacity);
+  }
+
+  //! Clears the trace and starts recording events.
+  inline void start_tracing(std::size_t buffer_capacity = std::size_t{1} << 14u) {
+    clear_trace(buffer_capacity);
+    __trace::__enabled.store(true, std::memory_order_release);
+  }
+
+  //! Stops recording events. The events that were recorded can still be collected.
+  inline void stop_tracing() noexcept {
+    __trace::__enabled.store(false, std::memory_order_release);
+  }
+
+  [[nodiscard]]
+  inline auto tracing_enabled() noexcept -> bool {
+    return __trace::__enabled.load(std::memory_order_relaxed);
+  }
+
+  //! Returns the events of all threads since the trace was last cleared, ordered by time. Events
+  //! that were overwritten in a full buffer, or whose thread's buffer was freed, are lost. This
+  //! can be called while threads record.
+  [[nodiscard]]
+  inline auto collect_trace() -> std::vector<trace_record> {
+    std::vector<trace_record> records;
+    __trace::__get_registry().__collect(records);
+    // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
+    std::stable_sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.time_ns < rhs.time_ns;
+    });
+    return records;
+  }
+} // namespace exec
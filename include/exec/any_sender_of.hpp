@@ -20,9 +20,27 @@
 #include "sequence_senders.hpp"
 
 #include <cstddef>
+#include <memory>
 #include <utility>
 
 namespace exec {
+  //! Configures where `any_receiver_ref<...>::any_sender<...>` keeps the sender it erases and
+  //! the operation state that connecting the sender returns. Each is constructed in an inline
+  //! buffer of `_SenderSize` or `_OperationSize` bytes if it fits, and is allocated with
+  //! `_Allocator` otherwise. An `any_sender_storage` value may be passed to `any_sender`
+  //! alongside the sender queries, e.g.
+  //! `any_receiver_ref<Sigs>::any_sender<any_sender_storage<64, 128>{}>`, to avoid allocating
+  //! the operation states of a recursion over type-erased senders.
+  template <
+    std::size_t _SenderSize = 3 * sizeof(void*),
+    std::size_t _OperationSize = 6 * sizeof(void*),
+    class _Allocator = std::allocator<std::byte>>
+  struct any_sender_storage {
+    static constexpr std::size_t sender_size = _SenderSize;
+    static constexpr std::size_t operation_size = _OperationSize;
+    using allocator_type = _Allocator;
+  };
+
   namespace __any {
     using namespace stdexec;
 
@@ -479,6 +497,13 @@ namespace exec {
         return __object_pointer_;
       }
 
+      //! Whether the stored object is a `_Tp`.
+      template <class _Tp>
+      [[nodiscard]]
+      auto __holds() const noexcept -> bool {
+        return __vtable_ == __get_vtable_of_type<_Tp>();
+      }
+
      private:
       template <class _Tp, class... _As>
       void __construct_small(_As&&... __args) {
@@ -578,8 +603,11 @@ namespace exec {
     using __immovable_storage_t =
       __t<__immovable_storage<_VTable, _Allocator, _InlineSize, _Alignment>>;
 
-    template <class _VTable, class _Allocator = std::allocator<std::byte>>
-    using __unique_storage_t = __t<__storage<_VTable, _Allocator>>;
+    template <
+      class _VTable,
+      class _Allocator = std::allocator<std::byte>,
+      std::size_t _InlineSize = 3 * sizeof(void*)>
+    using __unique_storage_t = __t<__storage<_VTable, _Allocator, false, _InlineSize>>;
 
     template <
       class _VTable,
@@ -800,8 +828,44 @@ namespace exec {
       }
     };
 
-    using __immovable_operation_storage =
-      __immovable_storage_t<__operation_vtable, std::allocator<std::byte>, 6 * sizeof(void*)>;
+    template <class _Storage>
+    using __immovable_operation_storage_t = __immovable_storage_t<
+      __operation_vtable,
+      typename _Storage::allocator_type,
+      _Storage::operation_size>;
+
+    using __immovable_operation_storage = __immovable_operation_storage_t<any_sender_storage<>>;
+
+    template <class _Ty>
+    inline constexpr bool __is_storage_config_v = false;
+
+    template <std::size_t _SenderSize, std::size_t _OperationSize, class _Allocator>
+    inline constexpr bool
+      __is_storage_config_v<any_sender_storage<_SenderSize, _OperationSize, _Allocator>> = true;
+
+    struct __is_storage_config {
+      template <class _Ty>
+      using __f = __mbool<__is_storage_config_v<__decay_t<_Ty>>>;
+    };
+
+    //! The `any_sender_storage` among the template arguments of `any_sender`, or the default
+    //! one if there is none.
+    template <class... _SenderQueries>
+    struct __storage_config_of {
+      using __t = any_sender_storage<>;
+    };
+
+    template <class _Ty, class... _SenderQueries>
+    struct __storage_config_of<_Ty, _SenderQueries...> {
+      using __t = __if_c<
+        __is_storage_config_v<__decay_t<_Ty>>,
+        __decay_t<_Ty>,
+        stdexec::__t<__storage_config_of<_SenderQueries...>>>;
+    };
+
+    //! The template arguments of `any_sender` that are queries.
+    template <class... _SenderQueries>
+    using __sender_queries_of = __minvoke<__mremove_if<__is_storage_config>, _SenderQueries...>;
 
     template <class _Sigs, class _Queries>
     using __receiver_ref = __mapply<__mbind_front<__q<__rec::__ref>, _Sigs>, _Queries>;
@@ -874,7 +938,7 @@ namespace exec {
     template <class _ReceiverId>
     using __stoppable_receiver_t = stdexec::__t<__stoppable_receiver<_ReceiverId>>;
 
-    template <class _ReceiverId, bool>
+    template <class _ReceiverId, class _Storage, bool>
     struct __operation {
       using _Receiver = stdexec::__t<_ReceiverId>;
 
@@ -899,12 +963,12 @@ namespace exec {
 
        private:
         __stoppable_receiver_t<_ReceiverId> __rec_;
-        __immovable_operation_storage __storage_{};
+        __immovable_operation_storage_t<_Storage> __storage_{};
       };
     };
 
-    template <class _ReceiverId>
-    struct __operation<_ReceiverId, false> {
+    template <class _ReceiverId, class _Storage>
+    struct __operation<_ReceiverId, _Storage, false> {
       using _Receiver = stdexec::__t<_ReceiverId>;
 
       class __t {
@@ -924,7 +988,7 @@ namespace exec {
 
        private:
         STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rec_;
-        __immovable_operation_storage __storage_{};
+        __immovable_operation_storage_t<_Storage> __storage_{};
       };
     };
 
@@ -947,9 +1011,14 @@ namespace exec {
       }
     };
 
-    template <class _Sigs, class _SenderQueries = __types<>, class _ReceiverQueries = __types<>>
+    template <
+      class _Sigs,
+      class _SenderQueries = __types<>,
+      class _ReceiverQueries = __types<>,
+      class _Storage = any_sender_storage<>>
     struct __sender {
       using __receiver_ref_t = __receiver_ref<_Sigs, _ReceiverQueries>;
+      using __operation_storage_t = __immovable_operation_storage_t<_Storage>;
       static constexpr bool __with_inplace_stop_token =
         __v<__mapply<__mall_of<__q<__is_not_stop_token_query_v>>, _ReceiverQueries>>;
 
@@ -961,7 +1030,7 @@ namespace exec {
           return *this;
         }
 
-        __immovable_operation_storage (*__connect_)(void*, __receiver_ref_t);
+        __operation_storage_t (*__connect_)(void*, __receiver_ref_t);
        private:
         template <sender_to<__receiver_ref_t> _Sender>
         STDEXEC_MEMFN_DECL(auto __create_vtable)(this __mtype<__vtable>, __mtype<_Sender>) noexcept
@@ -969,10 +1038,10 @@ namespace exec {
           static const __vtable __vtable_{
             {*__create_vtable(__mtype<__query_vtable<_SenderQueries>>{}, __mtype<_Sender>{})},
             [](void* __object_pointer, __receiver_ref_t __receiver)
-              -> __immovable_operation_storage {
+              -> __operation_storage_t {
               _Sender& __sender = *static_cast<_Sender*>(__object_pointer);
               using __op_state_t = connect_result_t<_Sender, __receiver_ref_t>;
-              return __immovable_operation_storage{
+              return __operation_storage_t{
                 std::in_place_type<__op_state_t>, __emplace_from{[&] {
                   return stdexec::connect(
                     static_cast<_Sender&&>(__sender), static_cast<__receiver_ref_t&&>(__receiver));
@@ -1012,7 +1081,7 @@ namespace exec {
           : __storage_{static_cast<_Sender&&>(__sndr)} {
         }
 
-        auto __connect(__receiver_ref_t __receiver) -> __immovable_operation_storage {
+        auto __connect(__receiver_ref_t __receiver) -> __operation_storage_t {
           return __storage_.__get_vtable()->__connect_(
             __storage_.__get_object_pointer(), static_cast<__receiver_ref_t&&>(__receiver));
         }
@@ -1027,12 +1096,17 @@ namespace exec {
 
         template <receiver_of<_Sigs> _Rcvr>
         auto connect(_Rcvr __rcvr) && //
-          -> stdexec::__t<__operation<stdexec::__id<_Rcvr>, __with_inplace_stop_token>> {
+          -> stdexec::__t<
+            __operation<stdexec::__id<_Rcvr>, _Storage, __with_inplace_stop_token>> {
           return {static_cast<__t&&>(*this), static_cast<_Rcvr&&>(__rcvr)};
         }
 
        private:
-        __unique_storage_t<__vtable> __storage_;
+        __unique_storage_t<
+          __vtable,
+          typename _Storage::allocator_type,
+          _Storage::sender_size>
+          __storage_;
       };
     };
 
@@ -1076,6 +1150,17 @@ namespace exec {
           _Tag{}, __storage_.__get_object_pointer(), static_cast<_As&&>(__as)...);
       }
 
+      //! Whether this holds a `_Scheduler` that compares equal to `__other`. Unlike comparing
+      //! with a type-erased copy of `__other`, this neither copies nor allocates.
+      template <scheduler _Scheduler>
+      auto __equals(const _Scheduler& __other) const noexcept -> bool {
+        if (!__storage_.template __holds<_Scheduler>()) {
+          return false;
+        }
+        const void* __p = __storage_.__get_object_pointer();
+        return *static_cast<const _Scheduler*>(__p) == __other;
+      }
+
      private:
       class __vtable : public __query_vtable<_SchedulerQueries, false> {
        public:
@@ -1178,8 +1263,11 @@ namespace exec {
 
     template <auto... _SenderQueries>
     class any_sender {
-      using __sender_base = stdexec::__t<
-        __any::__sender<_Completions, queries<_SenderQueries...>, queries<_ReceiverQueries...>>>;
+      using __sender_base = stdexec::__t<__any::__sender<
+        _Completions,
+        __any::__sender_queries_of<decltype(_SenderQueries)...>,
+        queries<_ReceiverQueries...>,
+        stdexec::__t<__any::__storage_config_of<decltype(_SenderQueries)...>>>>;
       __sender_base __sender_;
 
       template <class _Tag, stdexec::__decays_to<any_sender> Self, class... _As>
@@ -1217,11 +1305,14 @@ namespace exec {
         template <typename _Tag, typename _Sig>
         static auto __ret_fn(_Tag (*const)(_Sig)) -> _Tag;
 
+        // An any_sender_storage is passed on to the schedule-sender as it is.
+        static auto __ret_fn(...) -> void;
+
         template <class _Tag>
         struct __ret_equals_to {
           template <class _Sig>
           using __f =
-            stdexec::__mbool<STDEXEC_IS_SAME(_Tag, decltype(__ret_fn(static_cast<_Sig>(nullptr))))>;
+            stdexec::__mbool<STDEXEC_IS_SAME(_Tag, decltype(__ret_fn(stdexec::__declval<_Sig>())))>;
         };
 
         using __schedule_sender_queries = stdexec::__minvoke<
@@ -1229,18 +1320,25 @@ namespace exec {
             __ret_equals_to<stdexec::get_completion_scheduler_t<stdexec::set_value_t>>>,
           decltype(_SenderQueries)...>;
 
+        // The schedule-sender keeps the scheduled sender and its operation state like this
+        // sender does.
+        static constexpr stdexec::__t<__any::__storage_config_of<decltype(_SenderQueries)...>>
+          __schedule_storage{};
+
 #if STDEXEC_MSVC()
         // MSVCBUG https://developercommunity.visualstudio.com/t/ICE-and-non-ICE-bug-in-NTTP-argument-w/10361081
 
         static constexpr auto __any_scheduler_noexcept_signature =
           stdexec::get_completion_scheduler<stdexec::set_value_t>.signature<any_scheduler() noexcept>;
         template <class... _Queries>
-        using __schedule_sender_fn =
-          typename __schedule_receiver::template any_sender<__any_scheduler_noexcept_signature>;
+        using __schedule_sender_fn = typename __schedule_receiver::template any_sender<
+          __any_scheduler_noexcept_signature,
+          __schedule_storage>;
 #else
         template <class... _Queries>
         using __schedule_sender_fn = typename __schedule_receiver::template any_sender<
-          stdexec::get_completion_scheduler<stdexec::set_value_t>.template signature<any_scheduler() noexcept>>;
+          stdexec::get_completion_scheduler<stdexec::set_value_t>.template signature<any_scheduler() noexcept>,
+          __schedule_storage>;
 #endif
         using __schedule_sender =
           stdexec::__mapply<stdexec::__q<__schedule_sender_fn>, __schedule_sender_queries>;
@@ -1273,6 +1371,13 @@ namespace exec {
         }
 
         auto operator==(const any_scheduler&) const noexcept -> bool = default;
+
+        template <stdexec::__none_of<any_scheduler> _Scheduler>
+          requires stdexec::scheduler<_Scheduler>
+        friend auto operator==(const any_scheduler& __self, const _Scheduler& __other) noexcept
+          -> bool {
+          return __self.__scheduler_.__equals(__other);
+        }
       };
     };
   };
@@ -21,6 +21,8 @@
 #include "../stdexec/__detail/__optional.hpp"
 #include "env.hpp"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 namespace exec {
@@ -271,15 +273,47 @@ namespace exec {
     using __nest_sender_t = stdexec::__t<__nest_sender<__id<__decay_t<_Constrained>>>>;
 
     ////////////////////////////////////////////////////////////////////////////
-    // async_scope::spawn_future implementation
-    enum class __future_step {
-      __invalid = 0,
-      __created,
-      __future,
-      __no_future,
-      __deleted
-    };
+    // Allocation of spawned operations
+
+    //! Allocates and constructs a `_Ty` with the allocator of `__env`, or with `new` if the
+    //! environment has no allocator.
+    template <class _Ty, class _Env, class... _Args>
+    auto __new_op(const _Env& __env, _Args&&... __args) -> _Ty* {
+      if constexpr (__callable<get_allocator_t, const _Env&>) {
+        using _Alloc = __decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+        using _OpAlloc = typename std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+        _OpAlloc __op_alloc{stdexec::get_allocator(__env)};
+        _Ty* __op = std::allocator_traits<_OpAlloc>::allocate(__op_alloc, 1);
+        __scope_guard __g{[__op, &__op_alloc]() noexcept {
+          std::allocator_traits<_OpAlloc>::deallocate(__op_alloc, __op, 1);
+        }};
+        std::allocator_traits<_OpAlloc>::construct(
+          __op_alloc, __op, static_cast<_Args&&>(__args)...);
+        __g.__dismiss();
+        return __op;
+      } else {
+        return new _Ty(static_cast<_Args&&>(__args)...);
+      }
+    }
+
+    //! Destroys and deallocates an operation created by `__new_op`. `__env` is the environment
+    //! that the operation stores.
+    template <class _Ty, class _Env>
+    void __delete_op(_Ty* __op, const _Env& __env) noexcept {
+      if constexpr (__callable<get_allocator_t, const _Env&>) {
+        // Copy the allocator out of the operation before destroying it.
+        using _Alloc = __decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+        using _OpAlloc = typename std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+        _OpAlloc __op_alloc{stdexec::get_allocator(__env)};
+        std::allocator_traits<_OpAlloc>::destroy(__op_alloc, __op);
+        std::allocator_traits<_OpAlloc>::deallocate(__op_alloc, __op, 1);
+      } else {
+        delete __op;
+      }
+    }
 
+    ////////////////////////////////////////////////////////////////////////////
+    // async_scope::spawn_future implementation
     template <class _Sender, class _Env>
     struct __future_state;
 
@@ -297,10 +331,32 @@ namespace exec {
       void __complete() noexcept {
         __complete_(this);
       }
+    };
 
-      __subscription* __next_ = nullptr;
+    //! Marks a future state whose spawned operation has completed.
+    inline auto __completed_subscription() noexcept -> __subscription* {
+      static constinit __subscription __completed_{};
+      return &__completed_;
+    }
+
+    //! Marks a future state whose future was dropped before the spawned operation completed.
+    inline auto __abandoned_subscription() noexcept -> __subscription* {
+      static constinit __subscription __abandoned_{};
+      return &__abandoned_;
+    }
+
+    //! Destroys a future state with the allocator it was allocated with.
+    struct __delete_future_state {
+      template <class _State>
+      void operator()(_State* __state) const noexcept {
+        __state->__delete_(__state);
+      }
     };
 
+    template <class _Sender, class _Env>
+    using __future_state_ptr =
+      std::unique_ptr<__future_state<_Sender, _Env>, __delete_future_state>;
+
     template <class _SenderId, class _EnvId, class _ReceiverId>
     struct __future_op {
       using _Sender = stdexec::__t<_SenderId>;
@@ -316,29 +372,17 @@ namespace exec {
             __forward_consumer_.reset();
             auto __state = std::move(__state_);
             STDEXEC_ASSERT(__state != nullptr);
-            std::unique_lock __guard{__state->__mutex_};
-            // either the future is still in use or it has passed ownership to __state->__no_future_
-            if (
-              __state->__no_future_.get() != nullptr
-              || __state->__step_ != __future_step::__future) {
-              // invalid state - there is a code bug in the state machine
-              std::terminate();
-            } else if (get_stop_token(get_env(__rcvr_)).stop_requested()) {
-
-              __guard.unlock();
+            if (get_stop_token(get_env(__rcvr_)).stop_requested()) {
               stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
-              __guard.lock();
             } else {
               std::visit(
-                [this, &__guard]<class _Tup>(_Tup& __tup) {
+                [this]<class _Tup>(_Tup& __tup) {
                   if constexpr (same_as<_Tup, std::monostate>) {
                     std::terminate();
                   } else {
                     std::apply(
-                      [this, &__guard]<class... _As>(auto tag, _As&... __as) {
-                        __guard.unlock();
+                      [this]<class... _As>(auto tag, _As&... __as) {
                         tag(static_cast<_Receiver&&>(__rcvr_), static_cast<_As&&>(__as)...);
-                        __guard.lock();
                       },
                       __tup);
                   }
@@ -352,7 +396,7 @@ namespace exec {
         }
 
         STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        __future_state_ptr<_Sender, _Env> __state_;
         STDEXEC_ATTRIBUTE((no_unique_address)) stdexec::__optional<__forward_consumer> __forward_consumer_;
 
        public:
@@ -360,22 +404,17 @@ namespace exec {
 
         ~__t() noexcept {
           if (__state_ != nullptr) {
-            auto __raw_state = __state_.get();
-            std::unique_lock __guard{__raw_state->__mutex_};
-            if (__raw_state->__data_.index() > 0) {
-              // completed given sender
-              // state is no longer needed
-              return;
+            // Deregister from the state's stop source while the state is still ours.
+            __forward_consumer_.reset();
+            if (__state_->__try_abandon()) {
+              // The spawned operation will delete the state when it completes.
+              (void) __state_.release();
             }
-            __raw_state->__no_future_ = std::move(__state_);
-            __raw_state->__step_from_to_(
-              __guard, __future_step::__future, __future_step::__no_future);
           }
         }
 
         template <class _Receiver2>
-        explicit __t(
-          _Receiver2&& __rcvr, std::unique_ptr<__future_state<_Sender, _Env>> __state)
+        explicit __t(_Receiver2&& __rcvr, __future_state_ptr<_Sender, _Env> __state)
           : __subscription{{},
             [](__subscription* __self) noexcept -> void {
                 static_cast<__t*>(__self)->__complete_();
@@ -387,18 +426,9 @@ namespace exec {
         }
 
         void start() & noexcept {
-          try {
-            if (!!__state_) {
-              std::unique_lock __guard{__state_->__mutex_};
-              if (__state_->__data_.index() != 0) {
-                __guard.unlock();
-                __complete_();
-              } else {
-                __state_->__subscribers_.push_back(this);
-              }
-            }
-          } catch (...) {
-            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+          if (!!__state_ && !__state_->__try_subscribe(this)) {
+            // The spawned operation has already completed.
+            __complete_();
           }
         }
       };
@@ -446,68 +476,40 @@ namespace exec {
         __mtransform<__q<__completion_as_tuple_t>, __mbind_front_q<std::variant, std::monostate>>,
         _Completions>;
 
-    template <class _Ty>
-    struct __dynamic_delete {
-      __dynamic_delete()
-        : __delete_([](_Ty* __p) { delete __p; }) {
-      }
-
-      template <class _Uy>
-        requires convertible_to<_Uy*, _Ty*>
-      __dynamic_delete(std::default_delete<_Uy>)
-        : __delete_([](_Ty* __p) { delete static_cast<_Uy*>(__p); }) {
-      }
-
-      template <class _Uy>
-        requires convertible_to<_Uy*, _Ty*>
-      auto operator=(std::default_delete<_Uy> __d) -> __dynamic_delete& {
-        __delete_ = __dynamic_delete{__d}.__delete_;
-        return *this;
-      }
-
-      void operator()(_Ty* __p) {
-        __delete_(__p);
-      }
-
-      void (*__delete_)(_Ty*);
-    };
-
     template <class _Completions, class _Env>
     struct __future_state_base {
-      __future_state_base(_Env __env, const __impl* __scope)
+      using __delete_fn = void(__future_state_base*) noexcept;
+
+      __future_state_base(_Env __env, const __impl* __scope, __delete_fn* __delete)
         : __forward_scope_{std::in_place, __scope->__stop_source_.get_token(), __forward_stopped{&__stop_source_}}
+        , __delete_(__delete)
         , __env_(make_env(
             static_cast<_Env&&>(__env),
             stdexec::prop{get_stop_token, __scope->__stop_source_.get_token()})) {
       }
 
-      ~__future_state_base() {
-        std::unique_lock __guard{__mutex_};
-        if (__step_ == __future_step::__created) {
-          // exception during connect() will end up here
-          __step_from_to_(__guard, __future_step::__created, __future_step::__deleted);
-        } else if (__step_ != __future_step::__deleted) {
-          // completing the given sender before the future is dropped will end here
-          __step_from_to_(__guard, __future_step::__future, __future_step::__deleted);
-        }
+      //! Registers the operation to complete with the result. Returns false if the result is
+      //! already available.
+      auto __try_subscribe(__subscription* __subscriber) noexcept -> bool {
+        __subscription* __expected = nullptr;
+        return __subscriber_.compare_exchange_strong(
+          __expected, __subscriber, std::memory_order_acq_rel, std::memory_order_acquire);
       }
 
-      void __step_from_to_(
-        std::unique_lock<std::mutex>& __guard,
-        __future_step __from,
-        __future_step __to) {
-        STDEXEC_ASSERT(__guard.owns_lock());
-        auto actual = std::exchange(__step_, __to);
-        STDEXEC_ASSERT(actual == __from);
+      //! Passes the ownership of the state to the spawned operation if it has not completed yet.
+      auto __try_abandon() noexcept -> bool {
+        __subscription* __expected = nullptr;
+        return __subscriber_.compare_exchange_strong(
+          __expected, __abandoned_subscription(), std::memory_order_acq_rel);
       }
 
       inplace_stop_source __stop_source_;
       stdexec::__optional<inplace_stop_callback<__forward_stopped>> __forward_scope_;
-      std::mutex __mutex_;
-      __future_step __step_ = __future_step::__created;
-      std::unique_ptr<__future_state_base, __dynamic_delete<__future_state_base>> __no_future_;
+      __delete_fn* __delete_;
+      // nullptr until the future is either connected and started, or dropped, or until the
+      // spawned operation completes, whichever comes first.
+      std::atomic<__subscription*> __subscriber_{nullptr};
       __completions_as_variant<_Completions> __data_;
-      __intrusive_queue<&__subscription::__next_> __subscribers_;
       __env_t<_Env> __env_;
     };
 
@@ -521,22 +523,17 @@ namespace exec {
         __future_state_base<_Completions, _Env>* __state_;
         const __impl* __scope_;
 
-        void __dispatch_result_(std::unique_lock<std::mutex>& __guard) noexcept {
+        void __dispatch_result_() noexcept {
           auto& __state = *__state_;
-          auto __local_subscribers = std::move(__state.__subscribers_);
           __state.__forward_scope_.reset();
-          if (__state.__no_future_.get() != nullptr) {
+          // Publish the result. From here on, the future may delete the state at any time.
+          __subscription* __subscriber =
+            __state.__subscriber_.exchange(__completed_subscription(), std::memory_order_acq_rel);
+          if (__subscriber == __abandoned_subscription()) {
             // nobody is waiting for the results
-            // delete this and return
-            __state.__step_from_to_(__guard, __future_step::__no_future, __future_step::__deleted);
-            __guard.unlock();
-            __state.__no_future_.reset();
-            return;
-          }
-          __guard.unlock();
-          while (!__local_subscribers.empty()) {
-            auto* __sub = __local_subscribers.pop_front();
-            __sub->__complete();
+            __state.__delete_(&__state);
+          } else if (__subscriber != nullptr) {
+            __subscriber->__complete();
           }
         }
 
@@ -554,25 +551,19 @@ namespace exec {
 
         template <__movable_value... _As>
         void set_value(_As&&... __as) noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_value_t(), static_cast<_As&&>(__as)...);
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         template <__movable_value _Error>
         void set_error(_Error&& __err) noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_error_t(), static_cast<_Error&&>(__err));
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         void set_stopped() noexcept {
-          auto& __state = *__state_;
-          std::unique_lock __guard{__state.__mutex_};
           __save_completion(set_stopped_t());
-          __dispatch_result_(__guard);
+          __dispatch_result_();
         }
 
         auto get_env() const noexcept -> const __env_t<_Env>& {
@@ -590,7 +581,10 @@ namespace exec {
       using _Completions = __future_completions_t<_Sender, _Env>;
 
       __future_state(connect_t, _Sender&& __sndr, _Env __env, const __impl* __scope)
-        : __future_state_base<_Completions, _Env>(static_cast<_Env&&>(__env), __scope)
+        : __future_state_base<_Completions, _Env>(
+            static_cast<_Env&&>(__env),
+            __scope,
+            &__destroy_delete)
         , __op_(static_cast<_Sender&&>(__sndr), __future_receiver_t<_Sender, _Env>{this, __scope}) {
       }
 
@@ -607,6 +601,11 @@ namespace exec {
           static_cast<_Sender&&>(__sndr), __future_receiver_t<_Sender, _Env>{this, __scope});
       }
 
+      static void __destroy_delete(__future_state_base<_Completions, _Env>* __base) noexcept {
+        auto* __self = static_cast<__future_state*>(__base);
+        __scope::__delete_op(__self, __self->__env_);
+      }
+
       STDEXEC_ATTRIBUTE((no_unique_address)) [[]] //
         submit_result<_Sender, __future_receiver_t<_Sender, _Env>>
           __op_{};
@@ -633,17 +632,9 @@ namespace exec {
         auto operator=(__t&&) -> __t& = default;
 
         ~__t() noexcept {
-          if (__state_ != nullptr) {
-            auto __raw_state = __state_.get();
-            std::unique_lock __guard{__raw_state->__mutex_};
-            if (__raw_state->__data_.index() != 0) {
-              // completed given sender
-              // state is no longer needed
-              return;
-            }
-            __raw_state->__no_future_ = std::move(__state_);
-            __raw_state->__step_from_to_(
-              __guard, __future_step::__future, __future_step::__no_future);
+          if (__state_ != nullptr && __state_->__try_abandon()) {
+            // The spawned operation will delete the state when it completes.
+            (void) __state_.release();
           }
         }
 
@@ -662,13 +653,11 @@ namespace exec {
        private:
         friend struct async_scope;
 
-        explicit __t(std::unique_ptr<__future_state<_Sender, _Env>> __state) noexcept
+        explicit __t(__future_state_ptr<_Sender, _Env> __state) noexcept
           : __state_(std::move(__state)) {
-          std::unique_lock __guard{__state_->__mutex_};
-          __state_->__step_from_to_(__guard, __future_step::__created, __future_step::__future);
         }
 
-        std::unique_ptr<__future_state<_Sender, _Env>> __state_;
+        __future_state_ptr<_Sender, _Env> __state_;
       };
     };
 
@@ -744,7 +733,8 @@ namespace exec {
           : __spawn_op_base<_EnvId>{__env::__join(static_cast<_Env&&>(__env),
             __spawn_env_{__scope->__stop_source_.get_token()}),
             [](__spawn_op_base<_EnvId>* __op) {
-                delete static_cast<__t*>(__op);
+                auto* __self = static_cast<__t*>(__op);
+                __scope::__delete_op(__self, __self->__env_);
             }}
           , __data_(static_cast<_Sender&&>(__sndr), __spawn_receiver_t<_Env>{this}) {
         }
@@ -802,15 +792,15 @@ namespace exec {
         // this will connect and start the operation, after which the operation state is
         // responsible for deleting itself after it completes.
         [[maybe_unused]]
-        auto* __op =
-          new __op_t{nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_};
+        auto* __op = __scope::__new_op<__op_t>(
+          __env, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_);
       }
 
       template <__movable_value _Env = env<>, sender_in<__env_t<_Env>> _Sender>
       auto spawn_future(_Sender&& __sndr, _Env __env = {}) -> __future_t<_Sender, _Env> {
         using __state_t = __future_state<nest_result_t<_Sender>, _Env>;
-        auto __state = std::make_unique<__state_t>(
-          nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_);
+        __future_state_ptr<nest_result_t<_Sender>, _Env> __state{__scope::__new_op<__state_t>(
+          __env, nest(static_cast<_Sender&&>(__sndr)), static_cast<_Env&&>(__env), &__impl_)};
         return __future_t<_Sender, _Env>{std::move(__state)};
       }
 
@@ -18,6 +18,7 @@
 
 // The original idea is taken from libunifex and adapted to stdexec.
 
+#include <cstddef>
 #include <exception>
 
 #include "../stdexec/execution.hpp"
@@ -29,10 +30,21 @@ namespace exec {
   namespace __at_coro_exit {
     using namespace stdexec;
 
-    using __any_scheduler =                                                      //
-      any_receiver_ref<                                                          //
-        completion_signatures<set_error_t(std::exception_ptr), set_stopped_t()>> //
-      ::any_sender<>::any_scheduler<>;
+    // The required set_value_t() scheduler-sender completion signature is added in
+    // any_receiver_ref::any_sender::any_scheduler.
+    using __any_scheduler_completions =
+      completion_signatures<set_error_t(std::exception_ptr), set_stopped_t()>;
+
+    //! The schedule sender of the scheduler of a coroutine and its operation state are kept
+    //! inline if they fit this many bytes, so that transitioning back onto the scheduler after
+    //! a co_await does not allocate for common schedulers.
+    inline constexpr std::size_t __schedule_sender_size = 6 * sizeof(void*);
+    inline constexpr std::size_t __schedule_operation_size = 16 * sizeof(void*);
+
+    //! The scheduler of `exec::task` and of the coroutines that `at_coroutine_exit` and
+    //! `on_coroutine_*` run, which are handed the scheduler of the task.
+    using __any_scheduler = any_receiver_ref<__any_scheduler_completions>::any_sender<
+      any_sender_storage<__schedule_sender_size, __schedule_operation_size>{}>::any_scheduler<>;
 
     struct __die_on_stop_t {
       template <class _Receiver>
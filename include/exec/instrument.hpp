@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+#include "./__detail/__json.hpp"
+#include "./__detail/__task_clock.hpp"
+#include "./__detail/__trace.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace exec {
+  //! A histogram of durations in nanoseconds in the style of HdrHistogram. Values below 16 are
+  //! counted exactly, and larger values in 16 buckets per power of two, which bounds the relative
+  //! error of a percentile by 1/16. Recording is wait-free and may happen on any thread.
+  class latency_histogram {
+   public:
+    static constexpr std::size_t sub_bucket_bits = 4;
+    static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+    static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    //! The counts of a histogram at one point in time.
+    struct snapshot {
+      std::uint64_t count{0};
+      std::uint64_t sum{0};
+      std::uint64_t min{0};
+      std::uint64_t max{0};
+      std::vector<std::uint64_t> buckets;
+
+      [[nodiscard]]
+      auto mean() const noexcept -> double {
+        return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+      }
+
+      //! Returns the highest value that is counted in the same bucket as the value below which
+      //! a fraction `q` of the recorded values lie, but at most the largest recorded value.
+      [[nodiscard]]
+      auto percentile(double q) const noexcept -> std::uint64_t {
+        if (count == 0) {
+          return 0;
+        }
+        const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+          seen += buckets[bucket];
+          if (seen >= rank) {
+            return std::min(highest_value(bucket), max);
+          }
+        }
+        return max;
+      }
+    };
+
+    latency_histogram() = default;
+
+    latency_histogram(latency_histogram&&) = delete;
+
+    void record(std::uint64_t value) noexcept {
+      buckets_[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(value, std::memory_order_relaxed);
+      std::uint64_t min = min_.load(std::memory_order_relaxed);
+      while (value < min && !min_.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+      }
+      std::uint64_t max = max_.load(std::memory_order_relaxed);
+      while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+      }
+    }
+
+    //! Reads the counts without stopping threads that record. A snapshot that is taken while
+    //! values are recorded may be off by the values that are being recorded.
+    [[nodiscard]]
+    auto get_snapshot() const -> snapshot {
+      snapshot result{};
+      result.buckets.resize(bucket_count);
+      for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        result.buckets[bucket] = buckets_[bucket].load(std::memory_order_relaxed);
+      }
+      result.count = count_.load(std::memory_order_relaxed);
+      result.sum = sum_.load(std::memory_order_relaxed);
+      result.min = result.count == 0 ? 0 : min_.load(std::memory_order_relaxed);
+      result.max = max_.load(std::memory_order_relaxed);
+      return result;
+    }
+
+    void reset() noexcept {
+      for (auto& bucket: buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+      count_.store(0, std::memory_order_relaxed);
+      sum_.store(0, std::memory_order_relaxed);
+      min_.store((std::numeric_limits<std::uint64_t>::max)(), std::memory_order_relaxed);
+      max_.store(0, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    static constexpr auto bucket_of(std::uint64_t value) noexcept -> std::size_t {
+      if (value < sub_bucket_count) {
+        return static_cast<std::size_t>(value);
+      }
+      const auto exponent = static_cast<std::size_t>(std::bit_width(value)) - 1;
+      const auto shift = exponent - sub_bucket_bits;
+      const auto mantissa = static_cast<std::size_t>(value >> shift) & (sub_bucket_count - 1);
+      return (shift + 1) * sub_bucket_count + mantissa;
+    }
+
+    [[nodiscard]]
+    static constexpr auto lowest_value(std::size_t bucket) noexcept -> std::uint64_t {
+      if (bucket < sub_bucket_count) {
+        return bucket;
+      }
+      const std::size_t shift = bucket / sub_bucket_count - 1;
+      const std::uint64_t mantissa = bucket % sub_bucket_count;
+      return (sub_bucket_count + mantissa) << shift;
+    }
+
+    [[nodiscard]]
+    static constexpr auto highest_value(std::size_t bucket) noexcept -> std::uint64_t {
+      if (bucket < sub_bucket_count) {
+        return bucket;
+      }
+      const std::size_t shift = bucket / sub_bucket_count - 1;
+      return lowest_value(bucket) + ((std::uint64_t{1} << shift) - 1);
+    }
+
+   private:
+    std::array<std::atomic<std::uint64_t>, bucket_count> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> min_{(std::numeric_limits<std::uint64_t>::max)()};
+    std::atomic<std::uint64_t> max_{0};
+  };
+
+  //! The latencies of the senders that were instrumented with the same label.
+  struct latency_stage {
+    explicit latency_stage(const char* label) noexcept
+      : label{label} {
+    }
+
+    const char* label;
+    //! From connecting the sender to starting the operation.
+    latency_histogram connect_to_start;
+    //! From starting the operation to its completion.
+    latency_histogram start_to_completion;
+    //! From starting the operation until the scheduler that completes it began to run the task
+    //! that completed it. Only recorded for senders that complete on a different scheduler than
+    //! the one of their receiver, and only for schedulers of this library that note the begin of
+    //! their tasks.
+    latency_histogram queueing;
+  };
+
+  struct latency_stage_snapshot {
+    const char* label;
+    latency_histogram::snapshot connect_to_start;
+    latency_histogram::snapshot start_to_completion;
+    latency_histogram::snapshot queueing;
+  };
+
+  //! Collects the latencies of instrumented senders by label. Labels are compared by their
+  //! contents and must have static storage duration. Looking up a label is lock-free. If more
+  //! labels are used than the sink has room for, the extra ones are counted under "(other)".
+  //! While the sink is disabled, instrumented senders only check whether it is enabled. They
+  //! neither look up their label nor read the clock.
+  class latency_sink {
+   public:
+    explicit latency_sink(bool enabled = true, std::size_t max_labels = 64)
+      : mask_(std::bit_ceil(std::max<std::size_t>(max_labels, 1)) - 1)
+      , stages_(std::make_unique<std::atomic<latency_stage*>[]>(mask_ + 1))
+      , other_("(other)") {
+      if (enabled) {
+        enable();
+      }
+    }
+
+    latency_sink(latency_sink&&) = delete;
+
+    ~latency_sink() {
+      disable();
+      for (std::size_t i = 0; i <= mask_; ++i) {
+        delete stages_[i].load(std::memory_order_relaxed);
+      }
+    }
+
+    void enable() noexcept {
+      if (!enabled_.exchange(true, std::memory_order_relaxed)) {
+        __task_clock::__n_enabled.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    void disable() noexcept {
+      if (enabled_.exchange(false, std::memory_order_relaxed)) {
+        __task_clock::__n_enabled.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+
+    [[nodiscard]]
+    auto enabled() const noexcept -> bool {
+      return enabled_.load(std::memory_order_relaxed);
+    }
+
+    //! Returns the histograms of a label, which are created on first use.
+    auto stage(const char* label) -> latency_stage& {
+      std::size_t hash = 14'695'981'039'346'656'037ull;
+      for (const char* c = label; *c != '\0'; ++c) {
+        hash = (hash ^ static_cast<unsigned char>(*c)) * 1'099'511'628'211ull;
+      }
+      std::unique_ptr<latency_stage> created{};
+      for (std::size_t probe = 0; probe <= mask_; ++probe) {
+        std::atomic<latency_stage*>& slot = stages_[(hash + probe) & mask_];
+        latency_stage* current = slot.load(std::memory_order_acquire);
+        if (current == nullptr) {
+          if (!created) {
+            created = std::make_unique<latency_stage>(label);
+          }
+          if (slot.compare_exchange_strong(
+                current, created.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return *created.release();
+          }
+        }
+        if (std::strcmp(current->label, label) == 0) {
+          return *current;
+        }
+      }
+      other_used_.store(true, std::memory_order_relaxed);
+      return other_;
+    }
+
+    //! Returns the histograms of all labels that were used, and of "(other)" if it was used.
+    [[nodiscard]]
+    auto snapshot() const -> std::vector<latency_stage_snapshot> {
+      std::vector<latency_stage_snapshot> result;
+      auto add = [&](const latency_stage& stage) {
+        result.push_back(
+          {stage.label,
+           stage.connect_to_start.get_snapshot(),
+           stage.start_to_completion.get_snapshot(),
+           stage.queueing.get_snapshot()});
+      };
+      for (std::size_t i = 0; i <= mask_; ++i) {
+        if (const latency_stage* stage = stages_[i].load(std::memory_order_acquire)) {
+          add(*stage);
+        }
+      }
+      if (other_used_.load(std::memory_order_relaxed)) {
+        add(other_);
+      }
+      return result;
+    }
+
+    //! Clears the histograms of all labels.
+    void reset() noexcept {
+      auto clear = [](latency_stage& stage) noexcept {
+        stage.connect_to_start.reset();
+        stage.start_to_completion.reset();
+        stage.queueing.reset();
+      };
+      for (std::size_t i = 0; i <= mask_; ++i) {
+        if (latency_stage* stage = stages_[i].load(std::memory_order_acquire)) {
+          clear(*stage);
+        }
+      }
+      clear(other_);
+    }
+
+   private:
+    std::size_t mask_;
+    std::unique_ptr<std::atomic<latency_stage*>[]> stages_;
+    latency_stage other_;
+    std::atomic<bool> other_used_{false};
+    std::atomic<bool> enabled_{false};
+  };
+
+  namespace __instrument {
+    using namespace stdexec;
+
+    struct __data {
+      latency_sink* __sink_;
+      const char* __label_;
+    };
+
+    struct __state {
+      latency_sink* __sink_;
+      const char* __label_;
+      //! The histograms of the label, which are looked up when the operation is started while
+      //! the sink is enabled.
+      latency_stage* __stage_{nullptr};
+      bool __hops_{false};
+      std::uint64_t __connect_ns_{0};
+      std::uint64_t __start_ns_{0};
+    };
+
+    //! Whether a sender with the attributes `_Attrs` completes on a different scheduler than
+    //! the one that its receiver with the environment `_Env` runs on.
+    template <class _Attrs, class _Env>
+    auto __hops(const _Attrs& __attrs, const _Env& __env) noexcept -> bool {
+      if constexpr (!__callable<get_completion_scheduler_t<set_value_t>, const _Attrs&>) {
+        return false;
+      } else if constexpr (!__callable<get_scheduler_t, const _Env&>) {
+        return true;
+      } else {
+        auto __completion_sched = get_completion_scheduler<set_value_t>(__attrs);
+        auto __sched = get_scheduler(__env);
+        if constexpr (same_as<decltype(__completion_sched), decltype(__sched)>) {
+          return !(__completion_sched == __sched);
+        } else {
+          return true;
+        }
+      }
+    }
+
+    struct __instrument_impl : __sexpr_defaults {
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept {
+          return __completion_signatures_of_t<__child_of<_Sender>, _Env...>{};
+        };
+
+      static constexpr auto get_state = //
+        []<class _Sender, class _Receiver>(_Sender&& __sndr, _Receiver& __rcvr) noexcept
+        -> __state {
+        return __sndr.apply(
+          static_cast<_Sender&&>(__sndr),
+          [&]<class _Child>(__ignore, __data __d, const _Child& __child) -> __state {
+            __state __st{.__sink_ = __d.__sink_, .__label_ = __d.__label_};
+            if (__d.__sink_->enabled()) {
+              __st.__hops_ =
+                __instrument::__hops(stdexec::get_env(__child), stdexec::get_env(__rcvr));
+              __st.__connect_ns_ = __trace::__now_ns();
+            }
+            return __st;
+          });
+      };
+
+      static constexpr auto start = //
+        []<class _Receiver, class _ChildOp>(__state& __st, _Receiver&, _ChildOp& __child) noexcept
+        -> void {
+        if (__st.__sink_->enabled()) {
+          try {
+            __st.__stage_ = &__st.__sink_->stage(__st.__label_);
+          } catch (...) {
+            // Dropping a measurement is better than failing the operation that it measures.
+          }
+          if (__st.__stage_ != nullptr) {
+            __st.__start_ns_ = __trace::__now_ns();
+            if (__st.__connect_ns_ != 0) {
+              __st.__stage_->connect_to_start.record(__st.__start_ns_ - __st.__connect_ns_);
+            }
+          }
+        }
+        stdexec::start(__child);
+      };
+
+      static constexpr auto complete = //
+        []<class _Receiver, class _Tag, class... _Args>(
+          __ignore,
+          __state& __st,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if (__st.__start_ns_ != 0) {
+          const std::uint64_t __now = __trace::__now_ns();
+          __st.__stage_->start_to_completion.record(__now - __st.__start_ns_);
+          const std::uint64_t __begin = __task_clock::__task_begin_ns;
+          if (
+            same_as<_Tag, set_value_t> && __st.__hops_ && __begin >= __st.__start_ns_
+            && __begin <= __now) {
+            __st.__stage_->queueing.record(__begin - __st.__start_ns_);
+          }
+        }
+        _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+      };
+    };
+
+    struct instrument_t {
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, latency_sink& __sink, const char* __label) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<instrument_t>(__data{&__sink, __label}, static_cast<_Sender&&>(__sndr)));
+      }
+
+      STDEXEC_ATTRIBUTE((always_inline))
+      auto operator()(latency_sink& __sink, const char* __label) const noexcept
+        -> __binder_back<instrument_t, latency_sink&, const char*> {
+        return {{__sink, __label}, {}, {}};
+      }
+    };
+  } // namespace __instrument
+
+  using __instrument::instrument_t;
+
+  //! `instrument(sndr, sink, label)` records how long the operation of `sndr` waits between
+  //! connect and start, how long it takes from start to completion, and, if it completes on a
+  //! different scheduler than the one of its receiver, how long its work was queued there. The
+  //! latencies are recorded in the histograms of `label` in `sink`, which must outlive the
+  //! operation.
+  inline constexpr instrument_t instrument{};
+
+  //! Writes the count, mean, minimum, maximum and some percentiles of each histogram of the
+  //! snapshots as JSON. All durations are in nanoseconds.
+  inline void
+    write_latency_json(std::ostream& out, std::span<const latency_stage_snapshot> stages) {
+    auto write_histogram = [&](const char* name, const latency_histogram::snapshot& histogram) {
+      out << '"' << name << "\":{\"count\":" << histogram.count
+          << ",\"mean\":" << static_cast<std::uint64_t>(histogram.mean())
+          << ",\"min\":" << histogram.min << ",\"p50\":" << histogram.percentile(0.5)
+          << ",\"p90\":" << histogram.percentile(0.9) << ",\"p99\":" << histogram.percentile(0.99)
+          << ",\"p999\":" << histogram.percentile(0.999) << ",\"max\":" << histogram.max << '}';
+    };
+    out << "{\"stages\":[";
+    const char* separator = "\n";
+    for (const latency_stage_snapshot& stage: stages) {
+      out << separator << "{\"label\":";
+      __json::__write_string(out, stage.label);
+      out << ',';
+      write_histogram("connect_to_start", stage.connect_to_start);
+      out << ',';
+      write_histogram("start_to_completion", stage.start_to_completion);
+      out << ',';
+      write_histogram("queueing", stage.queueing);
+      out << '}';
+      separator = ",\n";
+    }
+    out << "\n]}\n";
+  }
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::__instrument::instrument_t> : exec::__instrument::__instrument_impl { };
+} // namespace stdexec
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../mapped_file.hpp"
+#include "../safe_file_descriptor.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace exec {
+  inline mapped_file::mapped_file(
+    const std::filesystem::path& __path,
+    mapped_file_options __options) {
+    safe_file_descriptor __fd{::open(__path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (!__fd) {
+      throw std::system_error(errno, std::system_category(), __path.string());
+    }
+    *this = mapped_file{__fd.native_handle(), __options};
+  }
+
+  inline mapped_file::mapped_file(int __fd, mapped_file_options __options) {
+    struct ::stat __stat{};
+    if (::fstat(__fd, &__stat) == -1) {
+      throw std::system_error(errno, std::system_category());
+    }
+    __size_ = static_cast<std::size_t>(__stat.st_size);
+    if (__size_ == 0) {
+      // mmap does not allow empty mappings
+      return;
+    }
+    int __flags = MAP_SHARED;
+    if (__options.populate) {
+      __flags |= MAP_POPULATE;
+    }
+    void* __ptr = ::mmap(nullptr, __size_, PROT_READ, __flags, __fd, 0);
+    if (__ptr == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category());
+    }
+    __region_ = memory_mapped_region{__ptr, __size_};
+    // The following are hints that the kernel is free to ignore.
+#ifdef MADV_HUGEPAGE
+    if (__options.huge_pages) {
+      ::madvise(__ptr, __size_, MADV_HUGEPAGE);
+    }
+#endif
+    if (__options.sequential) {
+      ::madvise(__ptr, __size_, MADV_SEQUENTIAL);
+    }
+  }
+
+  inline auto mapped_file::data() const noexcept -> std::span<const std::byte> {
+    return {static_cast<const std::byte*>(__region_.data()), __region_ ? __size_ : 0};
+  }
+
+  inline auto mapped_file::size() const noexcept -> std::size_t {
+    return data().size();
+  }
+
+  inline auto mapped_file::window(std::size_t __offset, std::size_t __size) const noexcept
+    -> std::span<const std::byte> {
+    std::span<const std::byte> __data = data();
+    __offset = std::min(__offset, __data.size());
+    return __data.subspan(__offset, std::min(__size, __data.size() - __offset));
+  }
+
+  inline auto mapped_file::window_count(std::size_t __window_size) const noexcept -> std::size_t {
+    return __window_size == 0 ? 0 : (size() + __window_size - 1) / __window_size;
+  }
+
+  inline void mapped_file::prefetch(std::size_t __offset, std::size_t __size) const {
+    __prefetch(window(__offset, __size));
+  }
+
+  inline void mapped_file::__prefetch(std::span<const std::byte> __window) {
+    if (__window.empty()) {
+      return;
+    }
+    // madvise requires a page-aligned start address
+    static const auto __page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    auto __begin = reinterpret_cast<std::uintptr_t>(__window.data());
+    auto __end = __begin + __window.size();
+    __begin &= ~(__page_size - 1);
+    void* __ptr = reinterpret_cast<void*>(__begin);
+    const std::size_t __length = __end - __begin;
+#ifdef MADV_POPULATE_READ
+    // Blocks until the pages are resident, which is what we want on a prefetching thread.
+    if (::madvise(__ptr, __length, MADV_POPULATE_READ) == 0) {
+      return;
+    }
+    // Kernels before 5.14 do not know MADV_POPULATE_READ
+    if (errno != EINVAL) {
+      throw std::system_error(errno, std::system_category());
+    }
+#endif
+    if (::madvise(__ptr, __length, MADV_WILLNEED) == -1) {
+      throw std::system_error(errno, std::system_category());
+    }
+  }
+} // namespace exec
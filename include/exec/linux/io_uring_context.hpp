@@ -22,11 +22,13 @@
 #  include <linux/io_uring.h>
 
 #  include "../../stdexec/execution.hpp"
+#  include "../../stdexec/__detail/__spin_loop_pause.hpp"
 #  include "../timed_scheduler.hpp"
 
 #  include "../__detail/__atomic_intrusive_queue.hpp"
 #  include "../__detail/__atomic_ref.hpp"
 #  include "../__detail/__bit_cast.hpp"
+#  include "../__detail/__trace.hpp"
 
 #  include "./safe_file_descriptor.hpp"
 #  include "./memory_mapped_region.hpp"
@@ -49,12 +51,28 @@
 #      define STDEXEC_HAS_IORING_OP_READ
 #    endif
 
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 7, 0)
+#      define STDEXEC_HAS_IORING_OP_SPLICE
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 8, 0)
+#      define STDEXEC_HAS_IORING_OP_TEE
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+#      define STDEXEC_HAS_IORING_OP_SEND_ZC
+#    endif
+
 #    include <sys/uio.h>
 #    include <sys/eventfd.h>
 #    include <sys/syscall.h>
+#    include <fcntl.h>
+#    include <unistd.h>
 
 #    include <algorithm>
 #    include <cstring>
+#    include <limits>
+#    include <span>
 
 namespace exec {
   namespace __io_uring {
@@ -97,8 +115,8 @@ namespace exec {
 
     // This base class maps the kernel's io_uring data structures into the process.
     struct __context_base : stdexec::__immovable {
-      explicit __context_base(unsigned __entries, unsigned __flags = 0)
-        : __params_{__context_base::__init_params(__flags)}
+      explicit __context_base(unsigned __entries, unsigned __flags = 0, unsigned __cq_entries = 0)
+        : __params_{__context_base::__init_params(__flags, __cq_entries)}
         , __ring_fd_{__io_uring_setup(__entries, __params_)}
         , __eventfd_{::eventfd(0, EFD_CLOEXEC)} {
         __throw_error_code_if(!__eventfd_, errno);
@@ -116,9 +134,14 @@ namespace exec {
         }
       }
 
-      static auto __init_params(unsigned __flags) noexcept -> ::io_uring_params {
+      static auto __init_params(unsigned __flags, unsigned __cq_entries) noexcept
+        -> ::io_uring_params {
         ::io_uring_params __params{};
         __params.flags = __flags;
+        if (__cq_entries != 0) {
+          __params.flags |= IORING_SETUP_CQSIZE;
+          __params.cq_entries = __cq_entries;
+        }
         return __params;
       }
 
@@ -148,6 +171,8 @@ namespace exec {
       void (*__submit_)(__task*, ::io_uring_sqe&) noexcept;
       // This function is called when the io operation is completed.
       // The status of the operation is passed as a parameter.
+      // Some operations (e.g. zero-copy sends) post more than one completion for a
+      // single submission. All but the last of them have IORING_CQE_F_MORE set.
       void (*__complete_)(__task*, const ::io_uring_cqe&) noexcept;
     };
 
@@ -172,6 +197,7 @@ namespace exec {
 
     struct __submission_result {
       __u32 __n_submitted;
+      std::size_t __n_pending;
       __task_queue __pending;
       __task_queue __ready;
     };
@@ -244,12 +270,16 @@ namespace exec {
           }
         }
         __tail_.store(__tail, std::memory_order_release);
+        if (__result.__n_submitted != 0) {
+          exec::__trace::__record(trace_event::submit, "io_uring_context", __result.__n_submitted);
+        }
         while (!__tasks.empty()) {
           __op = __tasks.pop_front();
           if (__op->__vtable_->__ready_(__op)) {
             __result.__ready.push_back(__op);
           } else {
             __result.__pending.push_back(__op);
+            ++__result.__n_pending;
           }
         }
         return __result;
@@ -259,6 +289,7 @@ namespace exec {
     class __completion_queue {
       __atomic_ref<__u32> __head_;
       __atomic_ref<__u32> __tail_;
+      __atomic_ref<__u32> __overflow_;
       ::io_uring_cqe* __entries_;
       __u32 __mask_;
      public:
@@ -267,13 +298,28 @@ namespace exec {
         const ::io_uring_params& __params) noexcept
         : __head_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.head)}
         , __tail_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.tail)}
+        , __overflow_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.overflow)}
         , __entries_{__at_offset_as<::io_uring_cqe*>(__region.data(), __params.cq_off.cqes)}
         , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.ring_mask)} {
       }
 
+      // The number of completions that the kernel had to drop because the completion queue was
+      // full. This can only happen on kernels that lack IORING_FEAT_NODROP.
+      [[nodiscard]]
+      auto n_dropped() const noexcept -> __u32 {
+        return __overflow_.load(std::memory_order_relaxed);
+      }
+
+      // Returns true if the kernel has posted completions that we did not process yet.
+      [[nodiscard]]
+      auto has_completions() const noexcept -> bool {
+        return __head_.load(std::memory_order_relaxed) != __tail_.load(std::memory_order_acquire);
+      }
+
       // This function first completes all tasks that are ready in the completion queue of the io_uring.
       // Then it completes all tasks that are ready in the given queue of ready tasks.
       // The function returns the number of previously submitted completed tasks.
+      // Completions that announce further completions for the same submission are not counted.
       auto complete(stdexec::__intrusive_queue<&__task::__next_> __ready = __task_queue{}) noexcept
         -> int {
         __u32 __head = __head_.load(std::memory_order_relaxed);
@@ -283,12 +329,21 @@ namespace exec {
           const __u32 __index = __head & __mask_;
           const ::io_uring_cqe& __cqe = __entries_[__index];
           auto* __op = bit_cast<__task*>(__cqe.user_data);
+#    ifdef IORING_CQE_F_MORE
+          const bool __is_last = !(__cqe.flags & IORING_CQE_F_MORE);
+#    else
+          constexpr bool __is_last = true;
+#    endif
           __op->__vtable_->__complete_(__op, __cqe);
           ++__head;
-          ++__count;
+          __count += __is_last;
           __tail = __tail_.load(std::memory_order_acquire);
         }
         __head_.store(__head, std::memory_order_release);
+        if (__count != 0) {
+          exec::__trace::__record(
+            trace_event::complete, "io_uring_context", static_cast<std::uint64_t>(__count));
+        }
         while (!__ready.empty()) {
           __task* __op = __ready.pop_front();
           ::io_uring_cqe __dummy_cqe{};
@@ -343,25 +398,58 @@ namespace exec {
       }
 
       void start() & noexcept;
+
+      // Completes the operation if it waits for a wakeup of a polled context.
+      void poll() noexcept;
+
+      // Polled contexts cannot read from the eventfd. Instead, the wakeup operation is counted as
+      // submitted without handing it to the kernel and it completes once a wakeup is requested.
+      bool __armed_ = false;
     };
 
     class __scheduler;
+    class __submission_batch;
 
     enum class until {
       stopped,
       empty
     };
 
+    struct __statistics {
+      // The number of operations that are currently submitted to the kernel.
+      std::size_t in_flight;
+      // The number of operations that wait for a free slot in the submission queue.
+      std::size_t pending;
+      // The maximum number of operations that waited for a free submission slot at once.
+      std::size_t max_pending;
+      // The number of completions that the kernel dropped because the completion queue was full.
+      std::size_t dropped;
+    };
+
     class __context : __context_base {
      public:
-      explicit __context(unsigned __entries = 1024, unsigned __flags = 0)
-        : __context_base(std::max(__entries, 2u), __flags)
+      /// @param __entries The size of the submission queue.
+      /// @param __flags Flags that are passed to io_uring_setup.
+      /// @param __cq_entries The size of the completion queue. If zero, the kernel's default of
+      /// twice the submission queue size is used.
+      ///
+      /// A context that is set up with IORING_SETUP_IOPOLL only supports reads and writes of files
+      /// that are opened with O_DIRECT on devices that support polling. The kernel fails all
+      /// other operations of such a context, including the timers of `schedule_after` and
+      /// `schedule_at`, which complete with a `std::system_error` of EINVAL. Plain `schedule`
+      /// does not enter the kernel and works on any context.
+      explicit __context(unsigned __entries = 1024, unsigned __flags = 0, unsigned __cq_entries = 0)
+        : __context_base(std::max(__entries, 2u), __flags, __cq_entries)
         , __completion_queue_{__completion_queue_region_ ? __completion_queue_region_ : __submission_queue_region_, __params_}
         , __submission_queue_{__submission_queue_region_, __submission_queue_entries_, __params_}
         , __wakeup_operation_{this, __eventfd_} {
       }
 
       auto try_wakeup() noexcept -> std::error_code {
+        if (__is_polled()) {
+          __wakeup_requested_.store(true, std::memory_order_release);
+          return {};
+        }
         std::uint64_t __wakeup = 1;
         if (::write(__eventfd_, &__wakeup, sizeof(__wakeup)) == -1) {
           return {errno, std::system_category()};
@@ -375,6 +463,20 @@ namespace exec {
         }
       }
 
+      /// @brief Wakes up the thread that drives the io context after new tasks have been
+      /// submitted, unless that thread is known to look at the request queue before it sleeps.
+      auto try_wakeup_after_submit() noexcept -> std::error_code {
+        // Pairs with the fence in __prepare_to_sleep(). Either we observe that the driving
+        // thread is about to sleep or it observes our submission.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (
+          !__is_sleeping_.load(std::memory_order_relaxed)
+          || !__is_sleeping_.exchange(false, std::memory_order_relaxed)) {
+          return {};
+        }
+        return try_wakeup();
+      }
+
       /// @brief Resets the io context to its initial state.
       void reset() {
         if (__is_running_.load(std::memory_order_relaxed) || __n_total_submitted_ > 0) {
@@ -402,6 +504,37 @@ namespace exec {
         return __is_running_.load(std::memory_order_relaxed);
       }
 
+      /// @brief Lets the thread that drives the io context poll the completion queue for up to
+      /// @p __duration before it blocks in the kernel.
+      ///
+      /// Busy polling trades CPU time of the driving thread for a lower latency between the
+      /// completion of an operation and the invocation of its receiver. It is disabled by
+      /// default. Contexts that are set up with IORING_SETUP_IOPOLL never block and poll
+      /// regardless of this setting. Note that such contexts only support O_DIRECT reads and
+      /// writes; other operations, including timers, fail with EINVAL. Use a separate context
+      /// without IOPOLL to busy poll for them.
+      void set_busy_poll_duration(std::chrono::nanoseconds __duration) noexcept {
+        __busy_poll_duration_.store(__duration.count(), std::memory_order_relaxed);
+      }
+
+      [[nodiscard]]
+      auto busy_poll_duration() const noexcept -> std::chrono::nanoseconds {
+        return std::chrono::nanoseconds{__busy_poll_duration_.load(std::memory_order_relaxed)};
+      }
+
+      /// @brief Returns a snapshot of the submission statistics of this io context.
+      ///
+      /// This function is thread-safe. The values are updated by the thread that drives the
+      /// io context after each submission round.
+      [[nodiscard]]
+      auto get_statistics() const noexcept -> __statistics {
+        return {
+          .in_flight = __n_in_flight_.load(std::memory_order_relaxed),
+          .pending = __n_pending_.load(std::memory_order_relaxed),
+          .max_pending = __max_pending_.load(std::memory_order_relaxed),
+          .dropped = __completion_queue_.n_dropped()};
+      }
+
       /// @brief  Breaks out of the run loop of the io context without stopping the context.
       void finish() {
         __break_loop_.store(true, std::memory_order_release);
@@ -417,19 +550,34 @@ namespace exec {
         // finished the stop operation of the io context and we can immediately stop the operation inline.
         // Remark: As long as the stopping is in progress we can still submit new operations.
         // But no operation will be submitted to io uring unless it is a cancellation operation.
-        int __n = 0;
-        while (__n != __no_new_submissions
-               && !__n_submissions_in_flight_.compare_exchange_weak(
-                 __n, __n + 1, std::memory_order_acquire, std::memory_order_relaxed))
-          ;
-        if (__n == __no_new_submissions) {
+        if (!__begin_submission()) {
           __stop(__op);
           return false;
         } else {
           __requests_.push_front(__op);
-          [[maybe_unused]]
-          int __prev = __n_submissions_in_flight_.fetch_sub(1, std::memory_order_relaxed);
-          STDEXEC_ASSERT(__prev > 0);
+          __end_submission();
+          return true;
+        }
+      }
+
+      /// \brief Submits a queue of tasks to the io_uring with a single synchronization.
+      ///
+      /// The tasks are expected in reverse order, i.e. the task at the front of the queue is the
+      /// last one that will be submitted to the kernel.
+      /// \returns true if the tasks were submitted, false if this io context has been stopped.
+      /// In the latter case all tasks have been stopped.
+      auto submit(__task_queue __ops) noexcept -> bool {
+        if (__ops.empty()) {
+          return true;
+        }
+        if (!__begin_submission()) {
+          while (!__ops.empty()) {
+            __stop(__ops.pop_front());
+          }
+          return false;
+        } else {
+          __requests_.prepend(static_cast<__task_queue&&>(__ops));
+          __end_submission();
           return true;
         }
       }
@@ -439,33 +587,31 @@ namespace exec {
       /// This function is not thread-safe and must only be called from the thread that drives the io context.
       void run_some() noexcept {
         __n_total_submitted_ -= __completion_queue_.complete();
-        STDEXEC_ASSERT(
-          0 <= __n_total_submitted_
-          && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
-        __u32 __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
+        STDEXEC_ASSERT(0 <= __n_total_submitted_ && __n_total_submitted_ <= __max_in_flight());
         __pending_.append(__requests_.pop_all_reversed());
         __submission_result __result = __submission_queue_.submit(
           static_cast<__task_queue&&>(__pending_),
-          __max_submissions,
+          __submission_budget(),
           __stop_source_->stop_requested());
         __n_total_submitted_ += __result.__n_submitted;
         __n_newly_submitted_ += __result.__n_submitted;
-        STDEXEC_ASSERT(std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
+        STDEXEC_ASSERT(__n_total_submitted_ <= __max_in_flight());
         __pending_ = static_cast<__task_queue&&>(__result.__pending);
+        __update_statistics(__result.__n_pending);
         while (!__result.__ready.empty()) {
           __n_total_submitted_ -=
             __completion_queue_.complete(static_cast<__task_queue&&>(__result.__ready));
           STDEXEC_ASSERT(0 <= __n_total_submitted_);
           __pending_.append(__requests_.pop_all_reversed());
-          __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
           __result = __submission_queue_.submit(
             static_cast<__task_queue&&>(__pending_),
-            __max_submissions,
+            __submission_budget(),
             __stop_source_->stop_requested());
           __n_total_submitted_ += __result.__n_submitted;
           __n_newly_submitted_ += __result.__n_submitted;
-          STDEXEC_ASSERT(std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
+          STDEXEC_ASSERT(__n_total_submitted_ <= __max_in_flight());
           __pending_ = static_cast<__task_queue&&>(__result.__pending);
+          __update_statistics(__result.__n_pending);
         }
       }
 
@@ -500,22 +646,30 @@ namespace exec {
             __break_loop_.store(false, std::memory_order_relaxed);
             break;
           }
-          constexpr int __min_complete = 1;
-          STDEXEC_ASSERT(
-            0 <= __n_total_submitted_
-            && std::cmp_less_equal(__n_total_submitted_, __params_.cq_entries));
+          // If operations are pending only because the submission queue was full, we must not
+          // block: entering the kernel frees the submission queue and we can submit the rest.
+          int __min_complete = __pending_.empty() || __submission_budget() == 0 ? 1 : 0;
+          if (__min_complete != 0 && (__poll_for_work() || !__prepare_to_sleep())) {
+            __min_complete = 0;
+          }
+          STDEXEC_ASSERT(0 <= __n_total_submitted_ && __n_total_submitted_ <= __max_in_flight());
           int rc = __io_uring_enter(
             __ring_fd_,
             static_cast<unsigned>(__n_newly_submitted_),
             __min_complete,
             IORING_ENTER_GETEVENTS);
-          __throw_error_code_if(rc < 0 && rc != -EINTR, -rc);
-          if (rc != -EINTR) {
+          __is_sleeping_.store(false, std::memory_order_relaxed);
+          // EBUSY tells us that the kernel holds completions that did not fit into the
+          // completion queue. Nothing has been submitted; we reap the completion queue
+          // to make room for them and try again.
+          __throw_error_code_if(rc < 0 && rc != -EINTR && rc != -EBUSY, -rc);
+          if (rc >= 0) {
             STDEXEC_ASSERT(rc <= __n_newly_submitted_);
             __n_newly_submitted_ -= rc;
           }
           __n_total_submitted_ -= __completion_queue_.complete();
           STDEXEC_ASSERT(0 <= __n_total_submitted_);
+          __wakeup_operation_.poll();
           __pending_.append(__requests_.pop_all_reversed());
         }
         STDEXEC_ASSERT(__n_total_submitted_ <= 1);
@@ -623,9 +777,106 @@ namespace exec {
 
       auto get_scheduler() noexcept -> __scheduler;
 
+      /// @brief A scope in which io operations that are started on the current thread are
+      /// collected and submitted at once. See __submission_batch.
+      using submission_batch = __submission_batch;
+
      private:
       friend struct __wakeup_operation;
 
+      auto __begin_submission() noexcept -> bool {
+        int __n = 0;
+        while (__n != __no_new_submissions
+               && !__n_submissions_in_flight_.compare_exchange_weak(
+                 __n, __n + 1, std::memory_order_acquire, std::memory_order_relaxed))
+          ;
+        return __n != __no_new_submissions;
+      }
+
+      void __end_submission() noexcept {
+        [[maybe_unused]]
+        int __prev = __n_submissions_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+        STDEXEC_ASSERT(__prev > 0);
+      }
+
+      // Announces that the driving thread is about to block in the kernel. Returns false if
+      // there are new requests, in which case the thread must not block.
+      auto __prepare_to_sleep() noexcept -> bool {
+        __is_sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return __requests_.empty();
+      }
+
+      // The maximum number of operations that may be in flight in the kernel at the same time.
+      // Kernels with IORING_FEAT_NODROP keep completions that do not fit into the completion
+      // queue until we make room for them. Only if that feature is missing do we need to
+      // bound the number of in-flight operations by the size of the completion queue.
+      [[nodiscard]]
+      auto __max_in_flight() const noexcept -> std::ptrdiff_t {
+        if (__params_.features & IORING_FEAT_NODROP) {
+          return std::numeric_limits<std::ptrdiff_t>::max();
+        }
+        return static_cast<std::ptrdiff_t>(__params_.cq_entries);
+      }
+
+      // Completions of IOPOLL contexts are only reaped when we enter the kernel. Such contexts
+      // never block and cannot wait for the eventfd.
+      [[nodiscard]]
+      auto __is_polled() const noexcept -> bool {
+        return __params_.flags & IORING_SETUP_IOPOLL;
+      }
+
+      // Spins on the completion queue and the request queue before the driving thread blocks in
+      // the kernel. Returns true if there is work that can be done without blocking.
+      auto __poll_for_work() -> bool {
+        const bool __is_polled = this->__is_polled();
+        const auto __duration = busy_poll_duration();
+        if (!__is_polled && __duration <= std::chrono::nanoseconds::zero()) {
+          return false;
+        }
+        // Hand new submissions to the kernel before we start spinning.
+        if (__n_newly_submitted_ > 0) {
+          int rc = __io_uring_enter(__ring_fd_, static_cast<unsigned>(__n_newly_submitted_), 0, 0);
+          __throw_error_code_if(rc < 0 && rc != -EINTR && rc != -EBUSY, -rc);
+          if (rc >= 0) {
+            __n_newly_submitted_ -= rc;
+          }
+        }
+        const auto __deadline = std::chrono::steady_clock::now() + __duration;
+        for (unsigned __n_spins = 1;; ++__n_spins) {
+          if (__is_polled) {
+            int rc = __io_uring_enter(__ring_fd_, 0, 0, IORING_ENTER_GETEVENTS);
+            __throw_error_code_if(rc < 0 && rc != -EINTR && rc != -EBUSY, -rc);
+          }
+          if (
+            __completion_queue_.has_completions() || !__requests_.empty()
+            || __wakeup_requested_.load(std::memory_order_relaxed)) {
+            return true;
+          }
+          // Reading the clock is more expensive than checking the queues.
+          if (
+            !__is_polled && __n_spins % 64 == 0 && std::chrono::steady_clock::now() >= __deadline) {
+            return false;
+          }
+          stdexec::__spin_loop_pause();
+        }
+      }
+
+      [[nodiscard]]
+      auto __submission_budget() const noexcept -> __u32 {
+        return static_cast<__u32>(std::min<std::ptrdiff_t>(
+          __max_in_flight() - __n_total_submitted_, std::numeric_limits<__u32>::max()));
+      }
+
+      void __update_statistics(std::size_t __n_pending) noexcept {
+        __n_in_flight_.store(
+          static_cast<std::size_t>(__n_total_submitted_), std::memory_order_relaxed);
+        __n_pending_.store(__n_pending, std::memory_order_relaxed);
+        if (__n_pending > __max_pending_.load(std::memory_order_relaxed)) {
+          __max_pending_.store(__n_pending, std::memory_order_relaxed);
+        }
+      }
+
       // This constant is used for __n_submissions_in_flight to indicate that no new submissions
       // to this context will be completed by this context.
       static constexpr int __no_new_submissions = -1;
@@ -635,6 +886,12 @@ namespace exec {
       std::atomic<bool> __break_loop_{false};
       std::ptrdiff_t __n_total_submitted_{0};
       std::ptrdiff_t __n_newly_submitted_{0};
+      std::atomic<std::size_t> __n_in_flight_{0};
+      std::atomic<std::size_t> __n_pending_{0};
+      std::atomic<std::size_t> __max_pending_{0};
+      std::atomic<std::chrono::nanoseconds::rep> __busy_poll_duration_{0};
+      std::atomic<bool> __wakeup_requested_{false};
+      std::atomic<bool> __is_sleeping_{false};
       std::optional<stdexec::inplace_stop_source> __stop_source_{std::in_place};
       __completion_queue __completion_queue_;
       __submission_queue __submission_queue_;
@@ -645,7 +902,20 @@ namespace exec {
 
     inline void __wakeup_operation::start() & noexcept {
       if (!__context_->__stop_source_->stop_requested()) {
-        __context_->__pending_.push_front(this);
+        if (__context_->__is_polled()) {
+          __armed_ = true;
+          ++__context_->__n_total_submitted_;
+        } else {
+          __context_->__pending_.push_front(this);
+        }
+      }
+    }
+
+    inline void __wakeup_operation::poll() noexcept {
+      if (__armed_ && __context_->__wakeup_requested_.exchange(false, std::memory_order_acquire)) {
+        __armed_ = false;
+        --__context_->__n_total_submitted_;
+        start();
       }
     }
 
@@ -710,19 +980,77 @@ namespace exec {
         return __base_;
       }
 
-      void start() & noexcept {
-        __context& __context = __base_.context();
-        if (__context.submit(this)) {
-          if (auto __ec = __context.try_wakeup()) {
+      void start() & noexcept;
+
+     private:
+      _Base __base_;
+    };
+
+    // Collects the io operations that are started on the current thread for a given context
+    // and submits all of them with a single synchronization and at most one wakeup of the
+    // driving thread when the batch goes out of scope (or is flushed).
+    //
+    // Operations that are started in a batch make no progress before the batch is submitted.
+    // Waiting for any of them inside the scope of the batch will dead-lock.
+    class __submission_batch : stdexec::__immovable {
+     public:
+      explicit __submission_batch(__context& __context) noexcept
+        : __context_{__context}
+        , __previous_{__current_} {
+        __current_ = this;
+      }
+
+      ~__submission_batch() {
+        STDEXEC_ASSERT(__current_ == this);
+        __current_ = __previous_;
+        flush();
+      }
+
+      /// @brief Submits all operations that have been started in this batch so far.
+      void flush() noexcept {
+        if (!__tasks_.empty() && __context_.submit(static_cast<__task_queue&&>(__tasks_))) {
+          if (auto __ec = __context_.try_wakeup_after_submit()) {
             std::terminate(); // TODO: handle error
           }
         }
       }
 
      private:
-      _Base __base_;
+      template <__io_task>
+      friend struct __io_task_facade;
+
+      // Finds the innermost batch on this thread that submits to the given context.
+      static auto __find(__context& __context) noexcept -> __submission_batch* {
+        for (__submission_batch* __batch = __current_; __batch; __batch = __batch->__previous_) {
+          if (&__batch->__context_ == &__context) {
+            return __batch;
+          }
+        }
+        return nullptr;
+      }
+
+      void __push(__task* __op) noexcept {
+        __tasks_.push_front(__op);
+      }
+
+      __context& __context_;
+      __submission_batch* __previous_;
+      __task_queue __tasks_{};
+      static inline thread_local __submission_batch* __current_ = nullptr;
     };
 
+    template <__io_task _Base>
+    void __io_task_facade<_Base>::start() & noexcept {
+      __context& __context = __base_.context();
+      if (__submission_batch* __batch = __submission_batch::__find(__context)) {
+        __batch->__push(this);
+      } else if (__context.submit(this)) {
+        if (auto __ec = __context.try_wakeup_after_submit()) {
+          std::terminate(); // TODO: handle error
+        }
+      }
+    }
+
     template <class _ReceiverId>
     struct __schedule_operation {
       using _Receiver = stdexec::__t<_ReceiverId>;
@@ -816,7 +1144,9 @@ namespace exec {
           int expected = 1;
           if (__op_->__n_ops_.compare_exchange_strong(expected, 2, std::memory_order_relaxed)) {
             if (__op_->context().submit(this)) {
-              __op_->context().wakeup();
+              if (auto __ec = __op_->context().try_wakeup_after_submit()) {
+                std::terminate(); // TODO: handle error
+              }
             }
           }
         }
@@ -861,6 +1191,20 @@ namespace exec {
       static constexpr bool __has_submit_stop_v =
         requires(_Ty& __base, ::io_uring_sqe& __sqe) { __base.submit_stop(__sqe); };
 
+      // An operation that receives intermediate completions (IORING_CQE_F_MORE) for
+      // a single submission may observe them with complete_more().
+      template <class _Ty>
+      static constexpr bool __has_complete_more_v =
+        requires(_Ty& __base, const ::io_uring_cqe& __cqe) { __base.complete_more(__cqe); };
+
+      // An operation that needs more than one round trip to the kernel returns true
+      // from complete() to be submitted again.
+      template <class _Ty>
+      static constexpr bool __is_resubmittable_v =
+        requires(_Ty& __base, const ::io_uring_cqe& __cqe) {
+          { __base.complete(__cqe) } -> stdexec::same_as<bool>;
+        };
+
       using __base_t = __impl_base<_Base, __has_submit_stop_v<_Base>>;
 
       struct __impl : __base_t {
@@ -919,6 +1263,14 @@ namespace exec {
         }
 
         void complete(const ::io_uring_cqe& __cqe) noexcept {
+#    ifdef IORING_CQE_F_MORE
+          if (__cqe.flags & IORING_CQE_F_MORE) {
+            if constexpr (__has_complete_more_v<_Base>) {
+              this->__base_.complete_more(__cqe);
+            }
+            return;
+          }
+#    endif
           if (__n_ops_.fetch_sub(1, std::memory_order_relaxed) == 1) {
             __on_context_stop_.reset();
             __on_receiver_stop_.reset();
@@ -927,6 +1279,15 @@ namespace exec {
             auto token = stdexec::get_stop_token(stdexec::get_env(__receiver));
             if (__cqe.res == -ECANCELED || __context_.stop_requested() || token.stop_requested()) {
               stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
+            } else if constexpr (__is_resubmittable_v<_Base>) {
+              // We are on the io thread, which picks up the request queue after
+              // processing the completion queue. There is no need for a wakeup.
+              if (this->__base_.complete(__cqe) && !__context_.submit(this->__parent_)) {
+                // The context no longer accepts submissions. It has passed this operation
+                // to complete() with -ECANCELED, but as no submission was in flight that
+                // call did not complete the receiver.
+                stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
+              }
             } else {
               this->__base_.complete(__cqe);
             }
@@ -1072,6 +1433,297 @@ namespace exec {
       using __t = __stoppable_task_facade_t<__impl>;
     };
 
+    template <class _Receiver>
+    void __complete_with_byte_count(_Receiver&& __receiver, int __res) noexcept {
+      if (__res >= 0) {
+        stdexec::set_value(static_cast<_Receiver&&>(__receiver), static_cast<std::size_t>(__res));
+      } else {
+        stdexec::set_error(
+          static_cast<_Receiver&&>(__receiver),
+          std::make_exception_ptr(std::system_error(-__res, std::system_category())));
+      }
+    }
+
+    inline auto __clamp_length(std::size_t __size) noexcept -> __u32 {
+      return static_cast<__u32>(std::min<std::size_t>(__size, std::numeric_limits<__u32>::max()));
+    }
+
+#    ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+    template <class _ReceiverId>
+    struct __send_zc_operation;
+
+    struct __send_zc_params {
+      int __fd_;
+      std::span<const std::byte> __buffer_;
+      int __flags_;
+
+      template <class _ReceiverId>
+      using __operation = __send_zc_operation<_ReceiverId>;
+    };
+
+    template <class _ReceiverId>
+    struct __send_zc_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      // A zero-copy send posts two completions: the first one carries the result
+      // and has IORING_CQE_F_MORE set, the second one (IORING_CQE_F_NOTIF) tells us
+      // that the kernel does not reference the buffer anymore. We complete the
+      // receiver only after the notification so that the buffer's lifetime is
+      // tied to the lifetime of this operation.
+      class __impl : public __stoppable_op_base<_Receiver> {
+        __send_zc_params __params_;
+        int __result_{0};
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_SEND_ZC;
+          __sqe_.fd = __params_.__fd_;
+          __sqe_.addr = bit_cast<__u64>(__params_.__buffer_.data());
+          __sqe_.len = __clamp_length(__params_.__buffer_.size());
+          __sqe_.msg_flags = static_cast<__u32>(__params_.__flags_);
+          __sqe = __sqe_;
+        }
+
+        void complete_more(const ::io_uring_cqe& __cqe) noexcept {
+          __result_ = __cqe.res;
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          const int __res = (__cqe.flags & IORING_CQE_F_NOTIF) ? __result_ : __cqe.res;
+          if (__res == -ECANCELED) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+          } else {
+            __complete_with_byte_count(static_cast<_Receiver&&>(this->__receiver_), __res);
+          }
+        }
+
+        __impl(__context& __context, const __send_zc_params& __params, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __params_{__params} {
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+    template <class _ReceiverId>
+    struct __splice_operation;
+
+    struct __splice_params {
+      int __fd_in_;
+      std::int64_t __off_in_;
+      int __fd_out_;
+      std::int64_t __off_out_;
+      std::size_t __size_;
+      unsigned __flags_;
+
+      template <class _ReceiverId>
+      using __operation = __splice_operation<_ReceiverId>;
+    };
+
+    template <class _ReceiverId>
+    struct __splice_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        __splice_params __params_;
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_SPLICE;
+          __sqe_.fd = __params_.__fd_out_;
+          __sqe_.off = static_cast<__u64>(__params_.__off_out_);
+          __sqe_.splice_fd_in = __params_.__fd_in_;
+          __sqe_.splice_off_in = static_cast<__u64>(__params_.__off_in_);
+          __sqe_.len = __clamp_length(__params_.__size_);
+          __sqe_.splice_flags = __params_.__flags_;
+          __sqe = __sqe_;
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          __complete_with_byte_count(static_cast<_Receiver&&>(this->__receiver_), __cqe.res);
+        }
+
+        __impl(__context& __context, const __splice_params& __params, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __params_{__params} {
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+
+    template <class _ReceiverId>
+    struct __sendfile_operation;
+
+    struct __sendfile_params {
+      int __fd_out_;
+      int __fd_in_;
+      std::int64_t __offset_;
+      std::size_t __size_;
+
+      template <class _ReceiverId>
+      using __operation = __sendfile_operation<_ReceiverId>;
+    };
+
+    template <class _ReceiverId>
+    struct __sendfile_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      // Moves data from a file to a socket by splicing it through an intermediate
+      // pipe, i.e. the data never gets copied into user space. Each splice is
+      // one round trip to the kernel; the operation re-submits itself until all
+      // bytes are transferred or the input reaches its end.
+      class __impl : public __stoppable_op_base<_Receiver> {
+        static constexpr std::size_t __max_chunk_size = std::size_t{1} << 16;
+
+        __sendfile_params __params_;
+        std::size_t __n_transferred_{0};
+        std::size_t __n_in_pipe_{0};
+        safe_file_descriptor __pipe_read_{};
+        safe_file_descriptor __pipe_write_{};
+
+        void __finish(int __res) noexcept {
+          if (__res < 0) {
+            __complete_with_byte_count(static_cast<_Receiver&&>(this->__receiver_), __res);
+          } else {
+            stdexec::set_value(
+              static_cast<_Receiver&&>(this->__receiver_), std::size_t{__n_transferred_});
+          }
+        }
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_SPLICE;
+          if (__n_in_pipe_ == 0) {
+            __sqe_.fd = __pipe_write_;
+            __sqe_.off = static_cast<__u64>(-1);
+            __sqe_.splice_fd_in = __params_.__fd_in_;
+            __sqe_.splice_off_in = static_cast<__u64>(__params_.__offset_);
+            __sqe_.len = __clamp_length(std::min(__params_.__size_, __max_chunk_size));
+          } else {
+            __sqe_.fd = __params_.__fd_out_;
+            __sqe_.off = static_cast<__u64>(-1);
+            __sqe_.splice_fd_in = __pipe_read_;
+            __sqe_.splice_off_in = static_cast<__u64>(-1);
+            __sqe_.len = __clamp_length(__n_in_pipe_);
+          }
+          __sqe_.splice_flags = SPLICE_F_MOVE;
+          __sqe = __sqe_;
+        }
+
+        // Returns true if the operation needs to be submitted again.
+        auto complete(const ::io_uring_cqe& __cqe) noexcept -> bool {
+          if (__cqe.res < 0) {
+            __finish(__cqe.res);
+            return false;
+          }
+          const auto __n = static_cast<std::size_t>(__cqe.res);
+          if (__n_in_pipe_ == 0) {
+            if (__n == 0) {
+              // The input has reached its end.
+              __finish(0);
+              return false;
+            }
+            __n_in_pipe_ = __n;
+            __params_.__offset_ += static_cast<std::int64_t>(__n);
+            __params_.__size_ -= __n;
+            return true;
+          }
+          if (__n == 0) {
+            __finish(-EPIPE);
+            return false;
+          }
+          __n_in_pipe_ -= __n;
+          __n_transferred_ += __n;
+          if (__n_in_pipe_ > 0 || __params_.__size_ > 0) {
+            return true;
+          }
+          __finish(0);
+          return false;
+        }
+
+        __impl(__context& __context, const __sendfile_params& __params, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __params_{__params} {
+          int __fds[2];
+          __throw_error_code_if(::pipe2(__fds, O_CLOEXEC) < 0, errno);
+          __pipe_read_.reset(__fds[0]);
+          __pipe_write_.reset(__fds[1]);
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_TEE
+    template <class _ReceiverId>
+    struct __tee_operation;
+
+    struct __tee_params {
+      int __fd_in_;
+      int __fd_out_;
+      std::size_t __size_;
+      unsigned __flags_;
+
+      template <class _ReceiverId>
+      using __operation = __tee_operation<_ReceiverId>;
+    };
+
+    template <class _ReceiverId>
+    struct __tee_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        __tee_params __params_;
+
+       public:
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_TEE;
+          __sqe_.fd = __params_.__fd_out_;
+          __sqe_.splice_fd_in = __params_.__fd_in_;
+          __sqe_.len = __clamp_length(__params_.__size_);
+          __sqe_.splice_flags = __params_.__flags_;
+          __sqe = __sqe_;
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          __complete_with_byte_count(static_cast<_Receiver&&>(this->__receiver_), __cqe.res);
+        }
+
+        __impl(__context& __context, const __tee_params& __params, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __params_{__params} {
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+#    endif
+
     class __scheduler {
      public:
       __context* __context_;
@@ -1155,11 +1807,110 @@ namespace exec {
         }
       };
 
+      // A sender of an io operation that completes with the number of transferred bytes.
+      template <class _Params>
+      class __io_sender {
+        using __completion_sigs = stdexec::completion_signatures<
+          stdexec::set_value_t(std::size_t),
+          stdexec::set_error_t(std::exception_ptr),
+          stdexec::set_stopped_t()>;
+
+        template <class _Receiver>
+        using __operation_t =
+          stdexec::__t<typename _Params::template __operation<stdexec::__id<_Receiver>>>;
+
+       public:
+        using sender_concept = stdexec::sender_t;
+        using __id = __io_sender;
+        using __t = __io_sender;
+
+        __schedule_env __env_;
+        _Params __params_;
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __schedule_env {
+          return __env_;
+        }
+
+        template <class... _Env>
+        static auto get_completion_signatures(const __io_sender&, _Env&&...) noexcept
+          -> __completion_sigs {
+          return {};
+        }
+
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & -> __operation_t<_Receiver> {
+          return __operation_t<_Receiver>(
+            std::in_place, *__env_.__context_, __params_, static_cast<_Receiver&&>(__receiver));
+        }
+      };
+
       [[nodiscard]]
       auto schedule() const -> __schedule_sender {
         return __schedule_sender{__schedule_env{__context_}};
       }
 
+#    ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+      /// @brief Sends a buffer on a socket without copying it into the kernel.
+      ///
+      /// The sender completes with the number of bytes sent after the kernel has released
+      /// the buffer, i.e. the buffer must stay valid until the sender completes.
+      /// Sockets that do not support zero-copy transmission complete with an error.
+      [[nodiscard]]
+      auto send_zc(int __fd, std::span<const std::byte> __buffer, int __flags = 0) const
+        -> __io_sender<__send_zc_params> {
+        return {.__env_ = {__context_}, .__params_ = {__fd, __buffer, __flags}};
+      }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_SPLICE
+      /// @brief Moves up to @p __size bytes from @p __fd_in to @p __fd_out.
+      ///
+      /// One of the two file descriptors must refer to a pipe. An offset of -1 uses (and
+      /// advances) the current file position. Pipes require an offset of -1.
+      [[nodiscard]]
+      auto splice(
+        int __fd_in,
+        std::int64_t __off_in,
+        int __fd_out,
+        std::int64_t __off_out,
+        std::size_t __size,
+        unsigned __flags = 0) const -> __io_sender<__splice_params> {
+        return {
+          .__env_ = {__context_},
+          .__params_ = {__fd_in, __off_in, __fd_out, __off_out, __size, __flags}
+        };
+      }
+
+      /// @brief Transfers up to @p __size bytes of the file @p __fd_in to @p __fd_out.
+      ///
+      /// The transfer starts at @p __offset of the input file. The data is spliced through a
+      /// pipe owned by the operation and never copied into user space. The sender completes
+      /// with the number of bytes transferred, which is less than @p __size only if the end
+      /// of the input was reached.
+      [[nodiscard]]
+      auto sendfile(int __fd_out, int __fd_in, std::int64_t __offset, std::size_t __size) const
+        -> __io_sender<__sendfile_params> {
+        return {
+          .__env_ = {__context_},
+          .__params_ = {__fd_out, __fd_in, __offset, __size}
+        };
+      }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_TEE
+      /// @brief Duplicates up to @p __size bytes from the pipe @p __fd_in to the pipe @p __fd_out
+      /// without consuming them.
+      [[nodiscard]]
+      auto tee(int __fd_in, int __fd_out, std::size_t __size, unsigned __flags = 0) const
+        -> __io_sender<__tee_params> {
+        return {
+          .__env_ = {__context_},
+          .__params_ = {__fd_in, __fd_out, __size, __flags}
+        };
+      }
+#    endif
+
       friend auto tag_invoke(exec::now_t, const __scheduler&) noexcept
         -> std::chrono::time_point<std::chrono::steady_clock> {
         return std::chrono::steady_clock::now();
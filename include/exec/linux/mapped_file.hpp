@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/execution.hpp"
+
+#include "./memory_mapped_region.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace exec {
+  struct mapped_file_options {
+    // Fault in all pages of the file when it is mapped.
+    bool populate = false;
+    // Ask the kernel to back the mapping with transparent huge pages where possible.
+    bool huge_pages = false;
+    // Tell the kernel that the file will be read sequentially, which enables aggressive
+    // read-ahead and early reclaim of pages that have been read.
+    bool sequential = false;
+  };
+
+  // A read-only memory mapping of a whole file.
+  //
+  // Reading a page of the mapping that is not resident stalls the reading thread on a page
+  // fault. Use prefetch() to fault in windows of the file on a scheduler of your choice ahead
+  // of the threads that process them.
+  class mapped_file {
+    memory_mapped_region __region_{};
+    std::size_t __size_{0};
+
+    static void __prefetch(std::span<const std::byte> __window);
+
+   public:
+    mapped_file() = default;
+
+    explicit mapped_file(const std::filesystem::path& __path, mapped_file_options __options = {});
+
+    // Maps the file that is referred to by the given file descriptor. The descriptor can be
+    // closed after the file has been mapped.
+    explicit mapped_file(int __fd, mapped_file_options __options = {});
+
+    [[nodiscard]]
+    auto data() const noexcept -> std::span<const std::byte>;
+
+    [[nodiscard]]
+    auto size() const noexcept -> std::size_t;
+
+    // Returns the bytes [__offset, __offset + __size) of the file, clamped to its end.
+    [[nodiscard]]
+    auto window(std::size_t __offset, std::size_t __size) const noexcept
+      -> std::span<const std::byte>;
+
+    // The number of windows of size __window_size that cover the file.
+    [[nodiscard]]
+    auto window_count(std::size_t __window_size) const noexcept -> std::size_t;
+
+    // Faults in the pages of the given window in the calling thread.
+    void prefetch(std::size_t __offset, std::size_t __size) const;
+
+    // Returns a sender that faults in the pages of the given window on the given scheduler.
+    // The mapping must outlive the completion of the sender.
+    template <stdexec::scheduler _Scheduler>
+    [[nodiscard]]
+    auto prefetch(_Scheduler __sched, std::size_t __offset, std::size_t __size) const {
+      return stdexec::schedule(static_cast<_Scheduler&&>(__sched))
+           | stdexec::then([__window = window(__offset, __size)] { __prefetch(__window); });
+    }
+  };
+} // namespace exec
+
+#include "__detail/mapped_file.hpp"
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/__detail/__config.hpp"
+#include "__detail/__numa.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace exec {
+  class numa_pool_resource;
+
+  namespace __numa_pool {
+    //! Blocks are pooled in power-of-two size classes from 16 bytes up to 4 KiB. Larger or
+    //! over-aligned requests are forwarded to the upstream allocator.
+    inline constexpr std::size_t __min_class_log2 = 4;
+    inline constexpr std::size_t __n_classes = 9;
+    inline constexpr std::size_t __max_block_size = std::size_t{1}
+                                                 << (__min_class_log2 + __n_classes - 1);
+
+    //! The size of the slabs that are allocated on the node and carved into blocks.
+    inline constexpr std::size_t __slab_size = 64 * 1024;
+
+    //! How many free blocks of each size class a thread keeps for reuse. When a thread's list
+    //! is full, half of it is returned to the resource, from which threads whose lists are empty
+    //! refill, so that blocks flow back from threads that free them to threads that allocate them.
+    inline constexpr std::size_t __max_cached_blocks = 64;
+    inline constexpr std::size_t __batch_size = __max_cached_blocks / 2;
+
+    //! How many resources a thread keeps cached blocks for at the same time.
+    inline constexpr std::size_t __n_thread_caches = 4;
+
+    struct __free_block {
+      __free_block* __next_;
+    };
+
+    struct __free_list {
+      __free_block* __head_;
+      std::size_t __count_;
+
+      void __push(void* __pointer) noexcept {
+        __head_ = ::new (__pointer) __free_block{__head_};
+        ++__count_;
+      }
+
+      auto __pop() noexcept -> void* {
+        __free_block* __block = __head_;
+        __head_ = __block->__next_;
+        --__count_;
+        return __block;
+      }
+
+      //! Moves up to `__n` blocks from the front of this list to the front of `__other`.
+      void __move_to(__free_list& __other, std::size_t __n) noexcept {
+        for (; __n != 0 && __head_; --__n) {
+          __other.__push(__pop());
+        }
+      }
+    };
+
+    struct __slab {
+      __slab* __next_;
+    };
+
+    //! The blocks of one size class that are not cached by any thread, and the slabs that
+    //! they were carved from.
+    struct __depot {
+      std::mutex __mutex_;
+      __free_list __free_{};
+      __slab* __slabs_{nullptr};
+    };
+
+    //! The free lists that a thread keeps for one resource. A resource is identified by a
+    //! unique id rather than its address, so that a cache of a resource that has been destroyed
+    //! is never mistaken for the cache of a new resource at the same address.
+    struct __thread_cache {
+      std::uint64_t __id_;
+      __free_list __lists_[__n_classes];
+    };
+
+    //! The caches of the calling thread. They are trivially destructible, so that they remain
+    //! usable by other thread-local objects that are destroyed after `__drain`.
+    struct __thread_caches {
+      __thread_cache __caches_[__n_thread_caches];
+      std::size_t __next_victim_;
+      bool __drained_;
+    };
+
+    inline thread_local constinit __thread_caches __tls_caches{};
+
+    //! Returns the blocks cached by a thread to their resources when the thread exits.
+    struct __drain {
+      ~__drain();
+    };
+
+    inline auto __size_class(std::size_t __bytes) noexcept -> std::size_t {
+      const std::size_t __rounded = std::bit_ceil(__bytes | (std::size_t{1} << __min_class_log2));
+      return static_cast<std::size_t>(std::countr_zero(__rounded)) - __min_class_log2;
+    }
+
+    inline constexpr auto __block_size(std::size_t __class) noexcept -> std::size_t {
+      return std::size_t{1} << (__class + __min_class_log2);
+    }
+  } // namespace __numa_pool
+
+  //! A `std::pmr::memory_resource` that pools small blocks in slabs allocated on one NUMA node
+  //! with `numa_allocator`. Each thread keeps free lists of the blocks it freed, and hands them
+  //! out again to its later allocations of the same size class without synchronization. Blocks
+  //! may be freed on a different thread from the one that allocated them; they are returned to
+  //! the resource in batches when the freeing thread has cached enough of them or exits. This
+  //! makes the short-lived allocations of parallel work, such as per-operation task storage,
+  //! node-local and cheap. Slabs are released when the resource is destroyed.
+  //!
+  //! Use `std::pmr::polymorphic_allocator` to inject the resource into the environment of a
+  //! receiver with `stdexec::get_allocator`.
+  class numa_pool_resource : public std::pmr::memory_resource {
+   public:
+    numa_pool_resource() noexcept
+      : numa_pool_resource(0) {
+    }
+
+    explicit numa_pool_resource(int node) noexcept
+      : __node_{node} {
+      std::lock_guard __lock{__registry_mutex()};
+      __next_ = std::exchange(__registry_head(), this);
+      if (__next_) {
+        __next_->__prev_ = this;
+      }
+    }
+
+    numa_pool_resource(const numa_pool_resource&) = delete;
+    auto operator=(const numa_pool_resource&) -> numa_pool_resource& = delete;
+
+    ~numa_pool_resource() override {
+      {
+        std::lock_guard __lock{__registry_mutex()};
+        (__prev_ ? __prev_->__next_ : __registry_head()) = __next_;
+        if (__next_) {
+          __next_->__prev_ = __prev_;
+        }
+      }
+      numa_allocator<std::byte> __upstream{__node_};
+      for (__numa_pool::__depot& __depot: __depots_) {
+        while (__numa_pool::__slab* __slab = __depot.__slabs_) {
+          __depot.__slabs_ = __slab->__next_;
+          __upstream.deallocate(reinterpret_cast<std::byte*>(__slab), __numa_pool::__slab_size);
+        }
+      }
+    }
+
+    //! The NUMA node that the slabs of this resource are allocated on.
+    [[nodiscard]]
+    auto node() const noexcept -> int {
+      return __node_;
+    }
+
+   private:
+    friend struct __numa_pool::__drain;
+
+    auto do_allocate(std::size_t __bytes, std::size_t __alignment) -> void* override {
+      if (__alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(__bytes, std::align_val_t{__alignment});
+      }
+      if (__bytes > __numa_pool::__max_block_size) {
+        return __allocate_upstream(__bytes);
+      }
+      const std::size_t __class = __numa_pool::__size_class(__bytes);
+      __numa_pool::__thread_cache* __cache = __thread_cache();
+      if (!__cache) {
+        __numa_pool::__free_list __list{};
+        __refill(__list, __class, 1);
+        return __list.__pop();
+      }
+      __numa_pool::__free_list& __list = __cache->__lists_[__class];
+      if (!__list.__head_) {
+        __refill(__list, __class, __numa_pool::__batch_size);
+      }
+      return __list.__pop();
+    }
+
+    void do_deallocate(void* __pointer, std::size_t __bytes, std::size_t __alignment) override {
+      if (__alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(__pointer, __bytes, std::align_val_t{__alignment});
+        return;
+      }
+      if (__bytes > __numa_pool::__max_block_size) {
+        numa_allocator<std::byte>{__node_}.deallocate(static_cast<std::byte*>(__pointer), __bytes);
+        return;
+      }
+      const std::size_t __class = __numa_pool::__size_class(__bytes);
+      __numa_pool::__thread_cache* __cache = __thread_cache();
+      if (!__cache) {
+        __numa_pool::__free_list __list{};
+        __list.__push(__pointer);
+        __release(__list, __class);
+        return;
+      }
+      __numa_pool::__free_list& __list = __cache->__lists_[__class];
+      if (__list.__count_ == __numa_pool::__max_cached_blocks) {
+        __numa_pool::__free_list __spilled{};
+        __list.__move_to(__spilled, __numa_pool::__batch_size);
+        __release(__spilled, __class);
+      }
+      __list.__push(__pointer);
+    }
+
+    [[nodiscard]]
+    auto do_is_equal(const std::pmr::memory_resource& __other) const noexcept -> bool override {
+      return this == &__other;
+    }
+
+    auto __allocate_upstream(std::size_t __bytes) const -> void* {
+      void* __pointer = numa_allocator<std::byte>{__node_}.allocate(__bytes);
+      if (!__pointer) {
+        throw std::bad_alloc();
+      }
+      return __pointer;
+    }
+
+    //! Moves up to `__n` blocks of the size class to `__list`, carving a new slab if there are
+    //! no free blocks left.
+    void __refill(__numa_pool::__free_list& __list, std::size_t __class, std::size_t __n) {
+      __numa_pool::__depot& __depot = __depots_[__class];
+      std::lock_guard __lock{__depot.__mutex_};
+      if (!__depot.__free_.__head_) {
+        auto* __slab = ::new (__allocate_upstream(__numa_pool::__slab_size))
+          __numa_pool::__slab{__depot.__slabs_};
+        __depot.__slabs_ = __slab;
+        const std::size_t __size = __numa_pool::__block_size(__class);
+        auto* __first = reinterpret_cast<std::byte*>(__slab) + __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        auto* __last = reinterpret_cast<std::byte*>(__slab) + __numa_pool::__slab_size;
+        for (std::byte* __block = __first; __last - __block >= static_cast<std::ptrdiff_t>(__size);
+             __block += __size) {
+          __depot.__free_.__push(__block);
+        }
+      }
+      __depot.__free_.__move_to(__list, __n);
+    }
+
+    //! Returns the blocks of `__list` to the resource.
+    void __release(__numa_pool::__free_list& __list, std::size_t __class) noexcept {
+      __numa_pool::__depot& __depot = __depots_[__class];
+      std::lock_guard __lock{__depot.__mutex_};
+      __list.__move_to(__depot.__free_, static_cast<std::size_t>(-1));
+    }
+
+    //! Returns the cache of the calling thread for this resource, or null if the caches of the
+    //! thread have already been drained because it is exiting. If the thread caches blocks of
+    //! too many resources, the blocks of one of them are returned to make room.
+    auto __thread_cache() noexcept -> __numa_pool::__thread_cache* {
+      __numa_pool::__thread_caches& __caches = __numa_pool::__tls_caches;
+      for (__numa_pool::__thread_cache& __cache: __caches.__caches_) {
+        if (__cache.__id_ == __id_) {
+          return &__cache;
+        }
+      }
+      if (__caches.__drained_) {
+        return nullptr;
+      }
+      // Make sure that the caches of this thread are drained when the thread exits.
+      static thread_local __numa_pool::__drain __drain_on_exit{};
+      (void) __drain_on_exit;
+      __numa_pool::__thread_cache* __victim = nullptr;
+      for (__numa_pool::__thread_cache& __cache: __caches.__caches_) {
+        if (__cache.__id_ == 0) {
+          __victim = &__cache;
+          break;
+        }
+      }
+      if (!__victim) {
+        __victim = &__caches.__caches_[__caches.__next_victim_++ % __numa_pool::__n_thread_caches];
+        __flush(*__victim);
+      }
+      __victim->__id_ = __id_;
+      return __victim;
+    }
+
+    //! Returns the blocks of a thread cache to its resource if that still exists, and empties
+    //! the cache. The blocks of a resource that has been destroyed went away with its slabs.
+    static void __flush(__numa_pool::__thread_cache& __cache) noexcept {
+      {
+        std::lock_guard __lock{__registry_mutex()};
+        for (numa_pool_resource* __resource = __registry_head(); __resource;
+             __resource = __resource->__next_) {
+          if (__resource->__id_ == __cache.__id_) {
+            for (std::size_t __class = 0; __class < __numa_pool::__n_classes; ++__class) {
+              __resource->__release(__cache.__lists_[__class], __class);
+            }
+            break;
+          }
+        }
+      }
+      __cache = __numa_pool::__thread_cache{};
+    }
+
+    //! The live resources, so that thread caches can tell whether their resource still exists.
+    static auto __registry_mutex() noexcept -> std::mutex& {
+      static std::mutex __mutex;
+      return __mutex;
+    }
+
+    static auto __registry_head() noexcept -> numa_pool_resource*& {
+      static constinit numa_pool_resource* __head = nullptr;
+      return __head;
+    }
+
+    static auto __next_id() noexcept -> std::uint64_t {
+      static constinit std::atomic<std::uint64_t> __id{0};
+      return __id.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    int __node_;
+    std::uint64_t __id_{__next_id()};
+    numa_pool_resource* __prev_{nullptr};
+    numa_pool_resource* __next_{nullptr};
+    __numa_pool::__depot __depots_[__numa_pool::__n_classes]{};
+  };
+
+  namespace __numa_pool {
+    inline __drain::~__drain() {
+      __thread_caches& __caches = __tls_caches;
+      __caches.__drained_ = true;
+      for (__thread_cache& __cache: __caches.__caches_) {
+        if (__cache.__id_ != 0) {
+          numa_pool_resource::__flush(__cache);
+        }
+      }
+    }
+  } // namespace __numa_pool
+} // namespace exec
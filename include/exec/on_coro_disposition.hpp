@@ -30,10 +30,7 @@ namespace exec {
   namespace __on_coro_disp {
     using namespace stdexec;
 
-    using __any_scheduler =                                                      //
-      any_receiver_ref<                                                          //
-        completion_signatures<set_error_t(std::exception_ptr), set_stopped_t()>> //
-      ::any_sender<>::any_scheduler<>;
+    using __any_scheduler = __at_coro_exit::__any_scheduler;
 
     template <class _Promise>
     concept __promise_with_disposition =              //
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/__detail/__config.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace exec {
+  namespace __recycling {
+    //! Blocks are cached in power-of-two size classes from 16 bytes up to 4 KiB.
+    inline constexpr std::size_t __min_class_log2 = 4;
+    inline constexpr std::size_t __n_classes = 9;
+    inline constexpr std::size_t __max_block_size = std::size_t{1}
+                                                 << (__min_class_log2 + __n_classes - 1);
+
+    //! How many free blocks of each size class a thread keeps for reuse. When a thread's list
+    //! is full, half of it is moved to a global list that threads whose lists are empty refill
+    //! from, so that blocks flow back from threads that free them to threads that allocate them.
+    inline constexpr std::size_t __max_cached_blocks = 64;
+    inline constexpr std::size_t __batch_size = __max_cached_blocks / 2;
+
+    //! How many free blocks of each size class the global list keeps.
+    inline constexpr std::size_t __max_global_blocks = 64 * __max_cached_blocks;
+
+    struct __free_block {
+      __free_block* __next_;
+    };
+
+    struct __global_free_list {
+      std::mutex __mutex_;
+      __free_block* __head_{nullptr};
+      std::size_t __count_{0};
+    };
+
+    inline __global_free_list __global_free_lists[__n_classes]{};
+
+    //! The free lists of the calling thread. They are trivially destructible, so that they
+    //! remain usable by other thread-local objects that are destroyed after `__drain`.
+    struct __free_lists {
+      __free_block* __heads_[__n_classes];
+      std::size_t __counts_[__n_classes];
+      bool __drained_;
+    };
+
+    inline thread_local constinit __free_lists __tls_free_lists{};
+
+    //! Returns the blocks cached by a thread to the global heap when the thread exits.
+    struct __drain {
+      ~__drain() {
+        __free_lists& __lists = __tls_free_lists;
+        for (std::size_t __class = 0; __class < __n_classes; ++__class) {
+          while (__free_block* __block = __lists.__heads_[__class]) {
+            __lists.__heads_[__class] = __block->__next_;
+            ::operator delete(static_cast<void*>(__block));
+          }
+          __lists.__counts_[__class] = 0;
+        }
+        __lists.__drained_ = true;
+      }
+    };
+
+    //! Makes sure that the cache of the calling thread is drained when the thread exits. This
+    //! must be called before the first block is put into the cache.
+    inline void __drain_at_exit() noexcept {
+      static thread_local __drain __drain_on_exit{};
+      (void) __drain_on_exit;
+    }
+
+    inline auto __size_class(std::size_t __bytes) noexcept -> std::size_t {
+      const std::size_t __rounded = std::bit_ceil(__bytes | (std::size_t{1} << __min_class_log2));
+      return static_cast<std::size_t>(std::countr_zero(__rounded)) - __min_class_log2;
+    }
+
+    //! Moves up to `__batch_size` blocks from the global list to the empty list of the thread.
+    inline void __refill(__free_lists& __lists, std::size_t __class) {
+      __global_free_list& __global = __global_free_lists[__class];
+      std::lock_guard __lock{__global.__mutex_};
+      std::size_t __count = 0;
+      __free_block* __last = nullptr;
+      for (__free_block* __block = __global.__head_; __block && __count < __batch_size;
+           __block = __block->__next_) {
+        __last = __block;
+        ++__count;
+      }
+      if (__last) {
+        __lists.__heads_[__class] = std::exchange(__global.__head_, __last->__next_);
+        __last->__next_ = nullptr;
+        __lists.__counts_[__class] = __count;
+        __global.__count_ -= __count;
+      }
+    }
+
+    //! Moves `__batch_size` blocks from the full list of the thread to the global list, or
+    //! frees them if the global list is full as well.
+    inline void __spill(__free_lists& __lists, std::size_t __class) noexcept {
+      __free_block* __first = __lists.__heads_[__class];
+      __free_block* __last = __first;
+      for (std::size_t __i = 1; __i < __batch_size; ++__i) {
+        __last = __last->__next_;
+      }
+      __lists.__heads_[__class] = std::exchange(__last->__next_, nullptr);
+      __lists.__counts_[__class] -= __batch_size;
+      __global_free_list& __global = __global_free_lists[__class];
+      {
+        std::lock_guard __lock{__global.__mutex_};
+        if (__global.__count_ + __batch_size <= __max_global_blocks) {
+          __last->__next_ = std::exchange(__global.__head_, __first);
+          __global.__count_ += __batch_size;
+          return;
+        }
+      }
+      while (__first) {
+        ::operator delete(static_cast<void*>(std::exchange(__first, __first->__next_)));
+      }
+    }
+
+    inline auto __allocate(std::size_t __bytes) -> void* {
+      if (__bytes > __max_block_size) {
+        return ::operator new(__bytes);
+      }
+      const std::size_t __class = __recycling::__size_class(__bytes);
+      __free_lists& __lists = __tls_free_lists;
+      if (!__lists.__heads_[__class] && !__lists.__drained_) {
+        __recycling::__drain_at_exit();
+        __recycling::__refill(__lists, __class);
+      }
+      if (__free_block* __block = __lists.__heads_[__class]) {
+        __lists.__heads_[__class] = __block->__next_;
+        --__lists.__counts_[__class];
+        return __block;
+      }
+      return ::operator new(std::size_t{1} << (__class + __min_class_log2));
+    }
+
+    inline void __deallocate(void* __pointer, std::size_t __bytes) noexcept {
+      if (__bytes > __max_block_size) {
+        ::operator delete(__pointer);
+        return;
+      }
+      const std::size_t __class = __recycling::__size_class(__bytes);
+      __free_lists& __lists = __tls_free_lists;
+      if (__lists.__drained_) {
+        ::operator delete(__pointer);
+        return;
+      }
+      if (__lists.__counts_[__class] == __max_cached_blocks) {
+        __recycling::__spill(__lists, __class);
+      }
+      __recycling::__drain_at_exit();
+      __lists.__heads_[__class] = ::new (__pointer) __free_block{__lists.__heads_[__class]};
+      ++__lists.__counts_[__class];
+    }
+  } // namespace __recycling
+
+  //! An allocator that keeps the small blocks freed by a thread in thread-local free lists and
+  //! hands them out again to later allocations of the same size class. This makes the steady
+  //! state of workloads that repeatedly allocate and free short-lived objects of similar sizes,
+  //! such as operation states, mostly free of calls into the global heap. Blocks may be freed
+  //! on a different thread from the one that allocated them. All instances compare equal.
+  template <class _Ty>
+  class recycling_allocator {
+   public:
+    using value_type = _Ty;
+
+    recycling_allocator() = default;
+
+    template <class _Uy>
+    constexpr recycling_allocator(const recycling_allocator<_Uy>&) noexcept {
+    }
+
+    [[nodiscard]]
+    auto allocate(std::size_t __n) -> _Ty* {
+      static_assert(alignof(_Ty) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+      if (__n > static_cast<std::size_t>(-1) / sizeof(_Ty)) {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<_Ty*>(__recycling::__allocate(__n * sizeof(_Ty)));
+    }
+
+    void deallocate(_Ty* __pointer, std::size_t __n) noexcept {
+      __recycling::__deallocate(__pointer, __n * sizeof(_Ty));
+    }
+
+    template <class _Uy>
+    friend constexpr auto
+      operator==(recycling_allocator, recycling_allocator<_Uy>) noexcept -> bool {
+      return true;
+    }
+  };
+} // namespace exec
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__meta.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace exec {
+  namespace __reduce {
+    using namespace stdexec;
+
+    template <class _Range>
+    using __range_reference_t = decltype(*std::begin(__declval<_Range&>()));
+
+    //! The reduction state carried by the sender: the initial value and the binary operation.
+    //! Like `std::reduce`, the result type of the reduction is the type of the initial value.
+    template <class _Init, class _Fun>
+    struct __data {
+      _Init __init_;
+      _Fun __fun_;
+    };
+
+    template <class _Init, class _Fun>
+    struct __reduce_value {
+      template <class...>
+      using __f = completion_signatures<set_value_t(_Init)>;
+    };
+
+    template <class _Sender, class _Init, class _Fun, class... _Env>
+    using __completions_t = //
+      transform_completion_signatures<
+        __completion_signatures_of_t<_Sender, _Env...>,
+        __eptr_completion,
+        __reduce_value<_Init, _Fun>::template __f>;
+
+    //! Folds `__range` into `__init` from left to right on the calling thread.
+    template <class _Range, class _Init, class _Fun>
+    auto __sequential_reduce(_Range&& __range, _Init __init, _Fun& __fun) -> _Init {
+      for (auto&& __value: __range) {
+        __init = __fun(std::move(__init), static_cast<decltype(__value)&&>(__value));
+      }
+      return __init;
+    }
+
+    struct __reduce_impl : __sexpr_defaults {
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept {
+          using __data_t = __decay_t<__data_of<_Sender>>;
+          return __completions_t<
+            __child_of<_Sender>,
+            decltype(__data_t::__init_),
+            decltype(__data_t::__fun_),
+            _Env...>{};
+        };
+
+      static constexpr auto complete = //
+        []<class _State, class _Receiver, class _Tag, class... _Args>(
+          __ignore,
+          _State& __state,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if constexpr (same_as<_Tag, set_value_t>) {
+          static_assert(sizeof...(_Args) == 1, "exec::reduce expects a sender of a single range");
+          try {
+            stdexec::set_value(
+              static_cast<_Receiver&&>(__rcvr),
+              __reduce::__sequential_reduce(
+                static_cast<_Args&&>(__args)..., std::move(__state.__init_), __state.__fun_));
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr), std::current_exception());
+          }
+        } else {
+          _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+        }
+      };
+    };
+
+    struct reduce_t {
+      template <sender _Sender, __movable_value _Init, __movable_value _Fun = std::plus<>>
+      auto operator()(_Sender&& __sndr, _Init __init, _Fun __fun = {}) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<reduce_t>(
+            __data<_Init, _Fun>{static_cast<_Init&&>(__init), static_cast<_Fun&&>(__fun)},
+            static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <__movable_value _Init, __movable_value _Fun = std::plus<>>
+        requires(!sender<_Init>)
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(_Init __init, _Fun __fun = {}) const
+        -> __binder_back<reduce_t, _Init, _Fun> {
+        return {{static_cast<_Init&&>(__init), static_cast<_Fun&&>(__fun)}, {}, {}};
+      }
+    };
+  } // namespace __reduce
+
+  using __reduce::reduce_t;
+
+  //! `reduce(sndr, init, fun)` reduces the range sent by `sndr` with the associative and
+  //! commutative operation `fun`, starting from `init`. By default the range is folded
+  //! sequentially on the thread that completes `sndr`; schedulers such as
+  //! `static_thread_pool` customize it to reduce in parallel.
+  inline constexpr reduce_t reduce{};
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::__reduce::reduce_t> : exec::__reduce::__reduce_impl { };
+} // namespace stdexec
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__meta.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace exec {
+  namespace __scan {
+    using namespace stdexec;
+
+    //! The initial value of an inclusive scan, which has none.
+    struct __no_init { };
+
+    //! The scan state carried by the sender: the initial value of an exclusive scan (or
+    //! `__no_init` for an inclusive scan) and the binary operation.
+    template <class _Init, class _Fun>
+    struct __data {
+      _Init __init_;
+      _Fun __fun_;
+    };
+
+    //! A scan sends the range it has written to: the input range when scanning in place, and
+    //! the second range otherwise.
+    template <class... _Ranges>
+    using __scan_value = completion_signatures<set_value_t(__decay_t<__mback<_Ranges...>>)>;
+
+    template <class _Sender, class... _Env>
+    using __completions_t = //
+      transform_completion_signatures<
+        __completion_signatures_of_t<_Sender, _Env...>,
+        __eptr_completion,
+        __scan_value>;
+
+    //! The type of the running value: the type of the initial value for an exclusive scan and
+    //! the value type of the input range for an inclusive scan, as in `std::*_scan`.
+    template <class _Init, class _InRange>
+    using __accumulator_t = __if_c<
+      same_as<_Init, __no_init>,
+      std::iter_value_t<decltype(std::begin(__declval<_InRange&>()))>,
+      _Init>;
+
+    template <class _Fun>
+    inline constexpr bool __is_plus_v = false;
+
+    template <class _Ty>
+    inline constexpr bool __is_plus_v<std::plus<_Ty>> = true;
+
+    //! Scans `__in` into `__out` on the calling thread. `__out` may be the same range as `__in`.
+    template <class _InRange, class _OutRange, class _Init, class _Fun>
+    void __sequential_scan(_InRange& __in, _OutRange& __out, _Init __init, _Fun& __fun) {
+      if constexpr (same_as<_Init, __no_init>) {
+        std::inclusive_scan(std::begin(__in), std::end(__in), std::begin(__out), std::ref(__fun));
+      } else {
+        std::exclusive_scan(
+          std::begin(__in),
+          std::end(__in),
+          std::begin(__out),
+          static_cast<_Init&&>(__init),
+          std::ref(__fun));
+      }
+    }
+
+    //! Reduces the non-empty range `[__first, __last)`. Sums of arithmetic values in contiguous
+    //! memory are accumulated in independent lanes so that the compiler can vectorize the loop.
+    template <class _Acc, class _Iter, class _Fun>
+    auto __reduce_block(_Iter __first, _Iter __last, _Fun& __fun) -> _Acc {
+      if constexpr (
+        std::contiguous_iterator<_Iter> && std::is_arithmetic_v<_Acc> && !same_as<_Acc, bool>
+        && same_as<_Acc, std::iter_value_t<_Iter>> && __is_plus_v<_Fun>) {
+        constexpr std::size_t __n_lanes = 8;
+        _Acc __lanes[__n_lanes]{};
+        const _Acc* __values = std::to_address(__first);
+        const auto __size = static_cast<std::size_t>(__last - __first);
+        std::size_t __i = 0;
+        for (; __i + __n_lanes <= __size; __i += __n_lanes) {
+          for (std::size_t __lane = 0; __lane < __n_lanes; ++__lane) {
+            __lanes[__lane] += __values[__i + __lane];
+          }
+        }
+        for (; __i < __size; ++__i) {
+          __lanes[0] += __values[__i];
+        }
+        _Acc __acc = __lanes[0];
+        for (std::size_t __lane = 1; __lane < __n_lanes; ++__lane) {
+          __acc += __lanes[__lane];
+        }
+        return __acc;
+      } else {
+        _Acc __acc(*__first);
+        for (++__first; __first != __last; ++__first) {
+          __acc = __fun(std::move(__acc), *__first);
+        }
+        return __acc;
+      }
+    }
+
+    //! Scans the non-empty range `[__first, __last)` into `__out`, continuing from `__prefix`,
+    //! the reduction of everything that precedes the block (or nothing, for the first block of
+    //! an inclusive scan).
+    template <bool _Inclusive, class _Acc, class _InIter, class _OutIter, class _Fun>
+    void __scan_block(
+      _InIter __first,
+      _InIter __last,
+      _OutIter __out,
+      std::optional<_Acc> __prefix,
+      _Fun& __fun) {
+      if constexpr (_Inclusive) {
+        _Acc __acc = __prefix ? _Acc(__fun(std::move(*__prefix), *__first)) : _Acc(*__first);
+        *__out = __acc;
+        for (++__first, ++__out; __first != __last; ++__first, ++__out) {
+          __acc = __fun(std::move(__acc), *__first);
+          *__out = __acc;
+        }
+      } else {
+        _Acc __acc = std::move(*__prefix);
+        for (; __first != __last; ++__first, ++__out) {
+          // Read the input before writing the output: they may alias.
+          _Acc __next = __fun(__acc, *__first);
+          *__out = std::move(__acc);
+          __acc = std::move(__next);
+        }
+      }
+    }
+
+    struct __scan_impl : __sexpr_defaults {
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept {
+          return __completions_t<__child_of<_Sender>, _Env...>{};
+        };
+
+      static constexpr auto complete = //
+        []<class _State, class _Receiver, class _Tag, class... _Args>(
+          __ignore,
+          _State& __state,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if constexpr (same_as<_Tag, set_value_t>) {
+          static_assert(
+            sizeof...(_Args) == 1 || sizeof...(_Args) == 2,
+            "exec::inclusive_scan and exec::exclusive_scan expect a sender of an input range "
+            "and, optionally, an output range");
+          try {
+            std::tuple<__decay_t<_Args>...> __ranges{static_cast<_Args&&>(__args)...};
+            auto& __out = std::get<sizeof...(_Args) - 1>(__ranges);
+            __scan::__sequential_scan(
+              std::get<0>(__ranges), __out, std::move(__state.__init_), __state.__fun_);
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr), std::move(__out));
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr), std::current_exception());
+          }
+        } else {
+          _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+        }
+      };
+    };
+
+    struct inclusive_scan_t {
+      template <sender _Sender, __movable_value _Fun = std::plus<>>
+      auto operator()(_Sender&& __sndr, _Fun __fun = {}) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<inclusive_scan_t>(
+            __data<__no_init, _Fun>{{}, static_cast<_Fun&&>(__fun)},
+            static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <__movable_value _Fun = std::plus<>>
+        requires(!sender<_Fun>)
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(_Fun __fun = {}) const
+        -> __binder_back<inclusive_scan_t, _Fun> {
+        return {{static_cast<_Fun&&>(__fun)}, {}, {}};
+      }
+    };
+
+    struct exclusive_scan_t {
+      template <sender _Sender, __movable_value _Init, __movable_value _Fun = std::plus<>>
+      auto operator()(_Sender&& __sndr, _Init __init, _Fun __fun = {}) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<exclusive_scan_t>(
+            __data<_Init, _Fun>{static_cast<_Init&&>(__init), static_cast<_Fun&&>(__fun)},
+            static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <__movable_value _Init, __movable_value _Fun = std::plus<>>
+        requires(!sender<_Init>)
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(_Init __init, _Fun __fun = {}) const
+        -> __binder_back<exclusive_scan_t, _Init, _Fun> {
+        return {{static_cast<_Init&&>(__init), static_cast<_Fun&&>(__fun)}, {}, {}};
+      }
+    };
+  } // namespace __scan
+
+  using __scan::inclusive_scan_t;
+  using __scan::exclusive_scan_t;
+
+  //! `inclusive_scan(sndr, fun)` computes the inclusive prefix sums of the range sent by `sndr`
+  //! with the associative operation `fun`. If `sndr` sends an input and an output range, the
+  //! results are written to the output range; otherwise the input range is scanned in place.
+  //! The scan completes with the range that was written to.
+  inline constexpr inclusive_scan_t inclusive_scan{};
+
+  //! `exclusive_scan(sndr, init, fun)` is like `inclusive_scan`, except that each output is
+  //! the reduction of `init` and the inputs that precede it.
+  inline constexpr exclusive_scan_t exclusive_scan{};
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::__scan::inclusive_scan_t> : exec::__scan::__scan_impl { };
+
+  template <>
+  struct __sexpr_impl<exec::__scan::exclusive_scan_t> : exec::__scan::__scan_impl { };
+} // namespace stdexec
@@ -263,7 +263,7 @@ namespace exec {
 
         template <same_as<__t> _Self, class _Rcvr>
         STDEXEC_MEMFN_DECL(auto subscribe)(this _Self&& __self, _Rcvr __rcvr)
-          -> stdexec::__t<__operation<stdexec::__id<_Rcvr>, true>> {
+          -> stdexec::__t<__operation<stdexec::__id<_Rcvr>, any_sender_storage<>, true>> {
           return {static_cast<_Self&&>(__self), static_cast<_Rcvr&&>(__rcvr)};
         }
 
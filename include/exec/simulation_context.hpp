@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "./__detail/__xorshift.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace exec {
+  class simulation_context;
+
+  namespace __simulation {
+    using namespace stdexec;
+
+    inline constexpr std::uint32_t __any_worker = (std::numeric_limits<std::uint32_t>::max)();
+
+    struct __task {
+      __task* __next_ = nullptr;
+      void (*__execute_)(__task*) noexcept = nullptr;
+
+      void __execute() noexcept {
+        (*__execute_)(this);
+      }
+    };
+
+    template <class _ReceiverId>
+    struct __operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      struct __t : __task {
+        using __id = __operation;
+
+        simulation_context* __ctx_;
+        std::uint32_t __worker_;
+        STDEXEC_ATTRIBUTE((no_unique_address)) _Receiver __rcvr_;
+
+        static void __execute_impl(__task* __p) noexcept {
+          auto& __rcvr = static_cast<__t*>(__p)->__rcvr_;
+          if (stdexec::get_stop_token(stdexec::get_env(__rcvr)).stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr));
+          }
+        }
+
+        __t(simulation_context* __ctx, std::uint32_t __worker, _Receiver __rcvr)
+          noexcept(__nothrow_move_constructible<_Receiver>)
+          : __task{.__next_ = nullptr, .__execute_ = &__execute_impl}
+          , __ctx_{__ctx}
+          , __worker_{__worker}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        void start() & noexcept;
+      };
+    };
+
+    //! A scheduler of a `simulation_context`. Work that is scheduled on it runs on one logical
+    //! worker of the context, or on a randomly chosen one if no worker was requested.
+    class __scheduler {
+      struct __sender {
+        using __t = __sender;
+        using __id = __sender;
+        using sender_concept = sender_t;
+        using completion_signatures =
+          stdexec::completion_signatures<set_value_t(), set_stopped_t()>;
+
+        template <class _Receiver>
+        using __operation_t = stdexec::__t<__operation<stdexec::__id<_Receiver>>>;
+
+        template <receiver_of<completion_signatures> _Receiver>
+        auto connect(_Receiver __rcvr) const noexcept(__nothrow_move_constructible<_Receiver>)
+          -> __operation_t<_Receiver> {
+          return {__ctx_, __worker_, static_cast<_Receiver&&>(__rcvr)};
+        }
+
+        struct __env {
+          using __t = __env;
+          using __id = __env;
+
+          simulation_context* __ctx_;
+          std::uint32_t __worker_;
+
+          template <class _CPO>
+          auto query(get_completion_scheduler_t<_CPO>) const noexcept -> __scheduler {
+            return __scheduler{__ctx_, __worker_};
+          }
+        };
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __env {
+          return __env{__ctx_, __worker_};
+        }
+
+        simulation_context* __ctx_;
+        std::uint32_t __worker_;
+      };
+
+      friend simulation_context;
+
+      explicit __scheduler(simulation_context* __ctx, std::uint32_t __worker) noexcept
+        : __ctx_{__ctx}
+        , __worker_{__worker} {
+      }
+
+      simulation_context* __ctx_;
+      std::uint32_t __worker_;
+
+     public:
+      using __t = __scheduler;
+      using __id = __scheduler;
+
+      auto operator==(const __scheduler&) const noexcept -> bool = default;
+
+      [[nodiscard]]
+      auto schedule() const noexcept -> __sender {
+        return __sender{__ctx_, __worker_};
+      }
+
+      //! The logical workers of the context run concurrently to each other as far as the
+      //! scheduled work can tell.
+      [[nodiscard]]
+      auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee {
+        return forward_progress_guarantee::parallel;
+      }
+    };
+
+    struct __env {
+      using __t = __env;
+      using __id = __env;
+
+      __scheduler __sched_;
+
+      [[nodiscard]]
+      auto query(get_scheduler_t) const noexcept -> __scheduler {
+        return __sched_;
+      }
+
+      [[nodiscard]]
+      auto query(get_delegation_scheduler_t) const noexcept -> __scheduler {
+        return __sched_;
+      }
+    };
+
+    struct __state {
+      std::exception_ptr __eptr_;
+      bool __done_ = false;
+    };
+
+    template <class... _Values>
+    struct __receiver {
+      struct __t {
+        using receiver_concept = receiver_t;
+        using __id = __receiver;
+
+        __state* __state_;
+        std::optional<std::tuple<_Values...>>* __values_;
+        __scheduler __sched_;
+
+        template <class... _As>
+          requires constructible_from<std::tuple<_Values...>, _As...>
+        void set_value(_As&&... __as) noexcept {
+          try {
+            __values_->emplace(static_cast<_As&&>(__as)...);
+          } catch (...) {
+            __state_->__eptr_ = std::current_exception();
+          }
+          __state_->__done_ = true;
+        }
+
+        template <class _Error>
+        void set_error(_Error __err) noexcept {
+          if constexpr (__same_as<_Error, std::exception_ptr>) {
+            __state_->__eptr_ = static_cast<_Error&&>(__err);
+          } else if constexpr (__same_as<_Error, std::error_code>) {
+            __state_->__eptr_ = std::make_exception_ptr(std::system_error(__err));
+          } else {
+            __state_->__eptr_ = std::make_exception_ptr(static_cast<_Error&&>(__err));
+          }
+          __state_->__done_ = true;
+        }
+
+        void set_stopped() noexcept {
+          __state_->__done_ = true;
+        }
+
+        [[nodiscard]]
+        auto get_env() const noexcept -> __env {
+          return __env{__sched_};
+        }
+      };
+    };
+
+    template <class _Sender, class _Continuation>
+    using __result_impl = __value_types_of_t<
+      _Sender,
+      __env,
+      __mtransform<__q<__decay_t>, _Continuation>,
+      __q<__msingle>>;
+
+    template <class _Sender>
+    using __result_t = __result_impl<_Sender, __qq<std::tuple>>;
+
+    template <class _Sender>
+    using __receiver_t = stdexec::__t<__result_impl<_Sender, __q<__receiver>>>;
+  } // namespace __simulation
+
+  using deterministic_scheduler = __simulation::__scheduler;
+
+  //! Runs the work of many logical workers on the calling thread, one scheduled operation at a
+  //! time. Each worker runs its operations in the order in which they were scheduled, but which
+  //! worker goes next is chosen by a random number generator with a fixed seed. Running the same
+  //! program with the same seed repeats the same interleaving, and running it with many seeds
+  //! explores many interleavings of the concurrent parts of a sender graph.
+  //!
+  //! The context is not thread-safe. All work must be scheduled from the thread that drives it.
+  class simulation_context {
+   public:
+    explicit simulation_context(std::uint64_t seed = 0, std::uint32_t num_workers = 4)
+      : seed_{seed}
+      , rng_{seed ^ 0x9e37'79b9'7f4a'7c15ull}
+      , workers_(num_workers == 0 ? 1 : num_workers) {
+    }
+
+    simulation_context(simulation_context&&) = delete;
+
+    ~simulation_context() {
+      STDEXEC_ASSERT(empty());
+    }
+
+    //! Returns a scheduler that places each operation on a random worker.
+    [[nodiscard]]
+    auto get_scheduler() noexcept -> deterministic_scheduler {
+      return deterministic_scheduler{this, __simulation::__any_worker};
+    }
+
+    //! Returns a scheduler that places all operations on the worker with the given index.
+    [[nodiscard]]
+    auto get_scheduler(std::uint32_t worker) noexcept -> deterministic_scheduler {
+      STDEXEC_ASSERT(worker < num_workers());
+      return deterministic_scheduler{this, worker};
+    }
+
+    [[nodiscard]]
+    auto seed() const noexcept -> std::uint64_t {
+      return seed_;
+    }
+
+    [[nodiscard]]
+    auto num_workers() const noexcept -> std::uint32_t {
+      return static_cast<std::uint32_t>(workers_.size());
+    }
+
+    //! The number of operations that have run so far.
+    [[nodiscard]]
+    auto steps() const noexcept -> std::size_t {
+      return steps_;
+    }
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+      return ready_ == 0;
+    }
+
+    //! Runs the first operation of a randomly chosen worker that has one. Returns false if no
+    //! operation was ready to run.
+    auto run_one() noexcept -> bool {
+      if (ready_ == 0) {
+        return false;
+      }
+      std::uint32_t nth = random_below(static_cast<std::uint32_t>(busy_workers()));
+      for (worker_queue& worker: workers_) {
+        if (worker.__head_ != nullptr && nth-- == 0) {
+          __simulation::__task* task = worker.__head_;
+          worker.__head_ = task->__next_;
+          if (worker.__head_ == nullptr) {
+            worker.__tail_ = nullptr;
+          }
+          --ready_;
+          ++steps_;
+          task->__execute();
+          return true;
+        }
+      }
+      STDEXEC_ASSERT(false);
+      return false;
+    }
+
+    //! Runs operations until none is ready. Returns the number of operations that ran.
+    auto run() noexcept -> std::size_t {
+      std::size_t count = 0;
+      while (run_one()) {
+        ++count;
+      }
+      return count;
+    }
+
+    //! Starts a sender and runs operations until it completes, like `stdexec::sync_wait`. The
+    //! sender sees the scheduler of this context as the scheduler of its environment. Terminates
+    //! if no operation is ready to run before the sender completes, because the sender could not
+    //! complete in any interleaving that follows from here.
+    template <stdexec::sender_in<__simulation::__env> Sender>
+    auto sync_wait(Sender&& sndr) -> std::optional<__simulation::__result_t<Sender>> {
+      __simulation::__state state{};
+      std::optional<__simulation::__result_t<Sender>> result{};
+      auto op = stdexec::connect(
+        static_cast<Sender&&>(sndr),
+        __simulation::__receiver_t<Sender>{&state, &result, get_scheduler()});
+      stdexec::start(op);
+      while (!state.__done_) {
+        if (!run_one()) {
+          std::terminate();
+        }
+      }
+      if (state.__eptr_) {
+        std::rethrow_exception(static_cast<std::exception_ptr&&>(state.__eptr_));
+      }
+      return result;
+    }
+
+   private:
+    template <class>
+    friend struct __simulation::__operation;
+
+    struct worker_queue {
+      __simulation::__task* __head_ = nullptr;
+      __simulation::__task* __tail_ = nullptr;
+    };
+
+    auto random_below(std::uint32_t bound) noexcept -> std::uint32_t {
+      return static_cast<std::uint32_t>((static_cast<std::uint64_t>(rng_()) * bound) >> 32u);
+    }
+
+    [[nodiscard]]
+    auto busy_workers() const noexcept -> std::size_t {
+      std::size_t count = 0;
+      for (const worker_queue& worker: workers_) {
+        count += worker.__head_ != nullptr ? 1 : 0;
+      }
+      return count;
+    }
+
+    void push(__simulation::__task* task, std::uint32_t worker) noexcept {
+      if (worker == __simulation::__any_worker) {
+        worker = random_below(num_workers());
+      }
+      worker_queue& target = workers_[worker];
+      task->__next_ = nullptr;
+      if (target.__tail_ == nullptr) {
+        target.__head_ = task;
+      } else {
+        target.__tail_->__next_ = task;
+      }
+      target.__tail_ = task;
+      ++ready_;
+    }
+
+    std::uint64_t seed_;
+    xorshift rng_;
+    std::vector<worker_queue> workers_;
+    std::size_t ready_{0};
+    std::size_t steps_{0};
+  };
+
+  template <class _ReceiverId>
+  inline void __simulation::__operation<_ReceiverId>::__t::start() & noexcept {
+    __ctx_->push(this, __worker_);
+  }
+} // namespace exec
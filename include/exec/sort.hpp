@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__meta.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace exec {
+  namespace __sort {
+    using namespace stdexec;
+
+    template <class... _Ranges>
+    using __sort_value = completion_signatures<set_value_t(__decay_t<_Ranges>...)>;
+
+    template <class _Sender, class... _Env>
+    using __completions_t = //
+      transform_completion_signatures<
+        __completion_signatures_of_t<_Sender, _Env...>,
+        __eptr_completion,
+        __sort_value>;
+
+    template <class _Comp, class _Ty>
+    inline constexpr bool __is_less_v = false;
+
+    template <class _Ty>
+    inline constexpr bool __is_less_v<std::less<_Ty>, _Ty> = true;
+
+    template <class _Ty>
+    inline constexpr bool __is_less_v<std::less<>, _Ty> = true;
+
+    //! Integers in contiguous memory that are sorted in ascending order can be radix sorted.
+    template <class _Iter, class _Comp>
+    concept __radix_sortable = //
+      std::contiguous_iterator<_Iter> && std::integral<std::iter_value_t<_Iter>>
+      && !same_as<std::iter_value_t<_Iter>, bool>
+      && __is_less_v<_Comp, std::iter_value_t<_Iter>>;
+
+    //! Sorts the integers in `[__first, __last)` with a least-significant-digit radix sort
+    //! that uses `[__scratch, __scratch + (__last - __first))` as its buffer.
+    template <class _Iter, class _Scratch>
+    void __radix_sort(_Iter __first, _Iter __last, _Scratch __scratch) noexcept {
+      using _Ty = std::iter_value_t<_Iter>;
+      using _Uy = std::make_unsigned_t<_Ty>;
+      constexpr std::size_t __n_bits = sizeof(_Ty) * CHAR_BIT;
+      // Flipping the sign bit orders negative values before positive ones.
+      constexpr _Uy __sign_flip = std::is_signed_v<_Ty> ? _Uy(_Uy(1) << (__n_bits - 1)) : _Uy();
+      const auto __size = static_cast<std::size_t>(__last - __first);
+      _Ty* __src = std::to_address(__first);
+      _Ty* __dst = std::to_address(__scratch);
+      for (std::size_t __shift = 0; __shift < __n_bits; __shift += 8) {
+        auto __digit = [__shift](_Ty __value) noexcept {
+          const auto __key = static_cast<_Uy>(static_cast<_Uy>(__value) ^ __sign_flip);
+          return static_cast<std::size_t>((__key >> __shift) & 0xff);
+        };
+        std::size_t __offsets[256]{};
+        for (std::size_t __i = 0; __i < __size; ++__i) {
+          ++__offsets[__digit(__src[__i])];
+        }
+        if (__offsets[__digit(__src[0])] == __size) {
+          // All values share this digit.
+          continue;
+        }
+        std::size_t __sum = 0;
+        for (std::size_t& __offset: __offsets) {
+          __sum += std::exchange(__offset, __sum);
+        }
+        for (std::size_t __i = 0; __i < __size; ++__i) {
+          __dst[__offsets[__digit(__src[__i])]++] = __src[__i];
+        }
+        std::swap(__src, __dst);
+      }
+      if (__src != std::to_address(__first)) {
+        std::copy(__src, __src + __size, __first);
+      }
+    }
+
+    //! Sorts the non-empty range `[__first, __last)`. `__scratch` points to as many constructed
+    //! elements as the range holds, which the radix sort of integral keys uses as its buffer.
+    template <class _Iter, class _Scratch, class _Comp>
+    void __sort_block(_Iter __first, _Iter __last, _Scratch __scratch, _Comp& __comp) {
+      if constexpr (__radix_sortable<_Iter, _Comp> && std::contiguous_iterator<_Scratch>) {
+        __sort::__radix_sort(__first, __last, __scratch);
+      } else {
+        std::sort(__first, __last, std::ref(__comp));
+      }
+    }
+
+    //! Returns how many of the first `__pos` elements of the stable merge of the sorted ranges
+    //! `[__a, __a + __na)` and `[__b, __b + __nb)` come from the first range.
+    template <class _Iter, class _Comp>
+    auto __merge_path(
+      _Iter __a,
+      std::size_t __na,
+      _Iter __b,
+      std::size_t __nb,
+      std::size_t __pos,
+      _Comp& __comp) -> std::size_t {
+      using __diff_t = std::iter_difference_t<_Iter>;
+      std::size_t __lo = __pos > __nb ? __pos - __nb : 0;
+      std::size_t __hi = std::min(__pos, __na);
+      while (__lo < __hi) {
+        const std::size_t __i = __lo + (__hi - __lo) / 2;
+        const std::size_t __j = __pos - __i;
+        // Equal elements are taken from the first range first.
+        if (!__comp(__b[static_cast<__diff_t>(__j - 1)], __a[static_cast<__diff_t>(__i)])) {
+          __lo = __i + 1;
+        } else {
+          __hi = __i;
+        }
+      }
+      return __lo;
+    }
+
+    struct __sort_impl : __sexpr_defaults {
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept {
+          return __completions_t<__child_of<_Sender>, _Env...>{};
+        };
+
+      static constexpr auto complete = //
+        []<class _State, class _Receiver, class _Tag, class... _Args>(
+          __ignore,
+          _State& __comp,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if constexpr (same_as<_Tag, set_value_t>) {
+          static_assert(sizeof...(_Args) == 1, "exec::sort expects a sender of a single range");
+          try {
+            __decay_t<__mfront<_Args...>> __range{static_cast<_Args&&>(__args)...};
+            std::sort(std::begin(__range), std::end(__range), std::ref(__comp));
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr), std::move(__range));
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr), std::current_exception());
+          }
+        } else {
+          _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+        }
+      };
+    };
+
+    struct sort_t {
+      template <sender _Sender, __movable_value _Comp = std::less<>>
+      auto operator()(_Sender&& __sndr, _Comp __comp = {}) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain,
+          __make_sexpr<sort_t>(static_cast<_Comp&&>(__comp), static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <__movable_value _Comp = std::less<>>
+        requires(!sender<_Comp>)
+      STDEXEC_ATTRIBUTE((always_inline)) auto operator()(_Comp __comp = {}) const
+        -> __binder_back<sort_t, _Comp> {
+        return {{static_cast<_Comp&&>(__comp)}, {}, {}};
+      }
+    };
+  } // namespace __sort
+
+  using __sort::sort_t;
+
+  //! `sort(sndr, comp)` sorts the range sent by `sndr` in place and completes with it. Like
+  //! `std::sort`, the sort is not stable. By default the range is sorted on the thread that
+  //! completes `sndr`; `static_thread_pool` customizes it to sort in parallel.
+  inline constexpr sort_t sort{};
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::__sort::sort_t> : exec::__sort::__sort_impl { };
+} // namespace stdexec
@@ -24,22 +24,38 @@
 #include "../stdexec/__detail/__manual_lifetime.hpp"
 #include "__detail/__atomic_intrusive_queue.hpp"
 #include "__detail/__bwos_lifo_queue.hpp"
+#include "__detail/__cpu_topology.hpp"
 #include "__detail/__xorshift.hpp"
 #include "__detail/__numa.hpp"
+#include "__detail/__task_clock.hpp"
+#include "__detail/__trace.hpp"
+#include "numa_pool_resource.hpp"
 
+#include "reduce.hpp"
+#include "scan.hpp"
+#include "sort.hpp"
 #include "sequence_senders.hpp"
 #include "sequence/iterate.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <compare>
 #include <condition_variable>
 #include <cstdint>
 #include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <span>
 #include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace exec {
@@ -254,6 +270,113 @@ namespace exec {
         static_thread_pool_& pool_;
       };
 
+      template <class SenderId, class Init, class Fun>
+      struct reduce_sender {
+        using Sender = stdexec::__t<SenderId>;
+        struct __t;
+      };
+
+      template <class Sender, class Init, class Fun>
+      using reduce_sender_t = __t<reduce_sender<__id<__decay_t<Sender>>, Init, Fun>>;
+
+      template <class CvrefSender, class Receiver, class Init, class Fun>
+      struct reduce_shared_state;
+
+      template <class CvrefSenderId, class ReceiverId, class Init, class Fun>
+      struct reduce_receiver {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class CvrefSenderId, class ReceiverId, class Init, class Fun>
+      struct reduce_op_state {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class SenderId, class Data>
+      struct scan_sender {
+        using Sender = stdexec::__t<SenderId>;
+        struct __t;
+      };
+
+      template <class Sender, class Data>
+      using scan_sender_t = __t<scan_sender<__id<__decay_t<Sender>>, Data>>;
+
+      template <class CvrefSender, class Receiver, class Data>
+      struct scan_shared_state;
+
+      template <class CvrefSenderId, class ReceiverId, class Data>
+      struct scan_receiver {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class CvrefSenderId, class ReceiverId, class Data>
+      struct scan_op_state {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class SenderId, class Comp>
+      struct sort_sender {
+        using Sender = stdexec::__t<SenderId>;
+        struct __t;
+      };
+
+      template <class Sender, class Comp>
+      using sort_sender_t = __t<sort_sender<__id<__decay_t<Sender>>, Comp>>;
+
+      template <class CvrefSender, class Receiver, class Comp>
+      struct sort_shared_state;
+
+      template <class CvrefSenderId, class ReceiverId, class Comp>
+      struct sort_receiver {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class CvrefSenderId, class ReceiverId, class Comp>
+      struct sort_op_state {
+        using CvrefSender = __cvref_t<CvrefSenderId>;
+        using Receiver = stdexec::__t<ReceiverId>;
+        struct __t;
+      };
+
+      template <class Sender>
+      static constexpr bool is_parallel_algorithm = //
+        sender_expr_for<Sender, exec::reduce_t> || sender_expr_for<Sender, exec::inclusive_scan_t>
+        || sender_expr_for<Sender, exec::exclusive_scan_t> || sender_expr_for<Sender, exec::sort_t>;
+
+      struct transform_algorithm {
+        template <class Data, class Sender>
+        auto operator()(exec::reduce_t, Data&& data, Sender&& sndr) {
+          auto [init, fun] = static_cast<Data&&>(data);
+          return reduce_sender_t<Sender, decltype(init), decltype(fun)>{
+            pool_, static_cast<Sender&&>(sndr), std::move(init), std::move(fun)};
+        }
+
+        template <class Tag, class Data, class Sender>
+          requires same_as<Tag, exec::inclusive_scan_t> || same_as<Tag, exec::exclusive_scan_t>
+        auto operator()(Tag, Data&& data, Sender&& sndr) {
+          return scan_sender_t<Sender, __decay_t<Data>>{
+            pool_, static_cast<Sender&&>(sndr), static_cast<Data&&>(data)};
+        }
+
+        template <class Comp, class Sender>
+        auto operator()(exec::sort_t, Comp&& comp, Sender&& sndr) {
+          return sort_sender_t<Sender, __decay_t<Comp>>{
+            pool_, static_cast<Sender&&>(sndr), static_cast<Comp&&>(comp)};
+        }
+
+        static_thread_pool_& pool_;
+      };
+
 #if STDEXEC_HAS_STD_RANGES()
       struct transform_iterate {
         template <class Range>
@@ -306,6 +429,41 @@ namespace exec {
           }
         }
 
+        // transform the generic range algorithms into parallel thread-pool senders
+        template <class Sender>
+          requires is_parallel_algorithm<Sender>
+        auto transform_sender(Sender&& sndr) const noexcept {
+          if constexpr (__completes_on<Sender, static_thread_pool_::scheduler>) {
+            auto sched = get_completion_scheduler<set_value_t>(get_env(sndr));
+            return __sexpr_apply(static_cast<Sender&&>(sndr), transform_algorithm{*sched.pool_});
+          } else {
+            static_assert(
+              __completes_on<Sender, static_thread_pool_::scheduler>,
+              "No static_thread_pool_ instance can be found in the sender's environment "
+              "on which to run the algorithm.");
+            return not_a_sender<__name_of<Sender>>();
+          }
+        }
+
+        template <class Sender, class Env>
+          requires is_parallel_algorithm<Sender>
+        auto transform_sender(Sender&& sndr, const Env& env) const noexcept {
+          if constexpr (__completes_on<Sender, static_thread_pool_::scheduler>) {
+            auto sched = get_completion_scheduler<set_value_t>(get_env(sndr));
+            return __sexpr_apply(static_cast<Sender&&>(sndr), transform_algorithm{*sched.pool_});
+          } else if constexpr (__starts_on<Sender, static_thread_pool_::scheduler, Env>) {
+            auto sched = stdexec::get_scheduler(env);
+            return __sexpr_apply(static_cast<Sender&&>(sndr), transform_algorithm{*sched.pool_});
+          } else {
+            static_assert( //
+              __starts_on<Sender, static_thread_pool_::scheduler, Env>
+                || __completes_on<Sender, static_thread_pool_::scheduler>,
+              "No static_thread_pool_ instance can be found in the sender's or receiver's "
+              "environment on which to run the algorithm.");
+            return not_a_sender<__name_of<Sender>>();
+          }
+        }
+
 #if STDEXEC_HAS_STD_RANGES()
         template <sender_expr_for<exec::iterate_t> Sender>
         auto transform_sender(Sender&& sndr) const noexcept {
@@ -327,7 +485,8 @@ namespace exec {
       static_thread_pool_(
         std::uint32_t threadCount,
         bwos_params params = {},
-        numa_policy numa = get_numa_policy());
+        numa_policy numa = get_numa_policy(),
+        topology_params topology = {});
       ~static_thread_pool_();
 
       struct scheduler {
@@ -455,6 +614,55 @@ namespace exec {
         return scheduler{*this, *get_remote_queue(), constraints};
       }
 
+      //! Returns the part of `[0, shape)` that the threads of a NUMA node work on in bulk
+      //! operations that use all threads of the pool. The shape is split into one contiguous part
+      //! per node, in the order of the nodes, proportional to the number of threads of the pool on
+      //! each node. For a pool that spans the machine, that is proportional to `num_cpus(node)`.
+      template <std::integral Shape>
+      [[nodiscard]]
+      auto numa_node_share(Shape shape, int node) const noexcept -> std::pair<Shape, Shape> {
+        STDEXEC_ASSERT(shape >= 0);
+        STDEXEC_ASSERT(node >= 0 && static_cast<std::size_t>(node) + 1 < threadsBeforeNode_.size());
+        using ushape_t = std::make_unsigned_t<Shape>;
+        const auto n = static_cast<ushape_t>(shape);
+        const auto total = static_cast<ushape_t>(threadCount_);
+        // floor(n * threads / total) without overflowing for large shapes
+        auto boundary = [&](std::size_t threads) {
+          const auto t = static_cast<ushape_t>(threads);
+          return static_cast<Shape>(n / total * t + n % total * t / total);
+        };
+        const auto index = static_cast<std::size_t>(node);
+        return {boundary(threadsBeforeNode_[index]), boundary(threadsBeforeNode_[index + 1])};
+      }
+
+      //! Returns the part of `[0, shape)` that a thread works on in bulk operations that use all
+      //! threads of the pool: the part of its NUMA node, split evenly among the threads of the
+      //! node in the order of their indices.
+      template <std::integral Shape>
+      [[nodiscard]]
+      auto bulk_share(Shape shape, std::uint32_t threadIndex) const noexcept
+        -> std::pair<Shape, Shape> {
+        const thread_state& state = *threadStates_[threadIndex];
+        const auto node = static_cast<std::size_t>(state.numa_node());
+        const auto [begin, end] = numa_node_share(shape, state.numa_node());
+        const auto [first, last] = even_share(
+          static_cast<Shape>(end - begin),
+          threadRankInNode_[threadIndex],
+          threadsBeforeNode_[node + 1] - threadsBeforeNode_[node]);
+        return {static_cast<Shape>(begin + first), static_cast<Shape>(begin + last)};
+      }
+
+      //! Returns the memory resource of the NUMA node of the calling thread, or of the first node
+      //! if the calling thread does not belong to the pool. The pool allocates the per-operation
+      //! task storage of its parallel algorithms from it.
+      auto get_memory_resource() noexcept -> numa_pool_resource& {
+        std::size_t index = get_remote_queue()->index_;
+        if (index < threadStates_.size()) {
+          return *memoryResources_[static_cast<std::size_t>(threadStates_[index]->numa_node())];
+        }
+        return *memoryResources_.front();
+      }
+
       auto get_remote_queue() noexcept -> remote_queue* {
         remote_queue* queue = remotes_.get();
         std::size_t index = 0;
@@ -513,8 +721,10 @@ namespace exec {
           , numa_node_(numa_node) {
         }
 
-        auto try_steal() noexcept -> task_base* {
-          return queue_->steal_front();
+        //! Steals the tasks of the victim's oldest stealable block, at most `max_count` of them.
+        template <class OutputIterator>
+        auto try_steal(OutputIterator out, std::size_t max_count) noexcept -> OutputIterator {
+          return queue_->steal_block(out, max_count);
         }
 
         [[nodiscard]]
@@ -560,6 +770,7 @@ namespace exec {
               params.numBlocks,
               params.blockSize,
               numa_allocator<task_base*>(this->numa_node_))
+          , stolen_(params.blockSize)
           , state_(state::running)
           , pool_(pool) {
           std::random_device rd;
@@ -573,16 +784,14 @@ namespace exec {
         auto notify() -> bool;
         void request_stop();
 
+        //! Sorts the other threads into rings of victims that widen with the level of the
+        //! topology at which this thread reaches them.
         void victims(const std::vector<workstealing_victim>& victims) {
-          for (workstealing_victim v: victims) {
-            if (v.index() == index_) {
-              // skip self
-              continue;
-            }
-            if (v.numa_node() == numa_node_) {
-              near_victims_.push_back(v);
+          const auto rings = __topology::__steal_rings(pool_->threadCpus_, index_);
+          for (std::size_t ring = 0; ring < steal_level_count; ++ring) {
+            for (std::uint32_t victim: rings[ring]) {
+              rings_[ring].push_back(victims[victim]);
             }
-            all_victims_.push_back(v);
           }
         }
 
@@ -611,8 +820,6 @@ namespace exec {
         auto try_pop() -> pop_result;
         auto try_remote() -> pop_result;
         auto try_steal(std::span<workstealing_victim> victims) -> pop_result;
-        auto try_steal_near() -> pop_result;
-        auto try_steal_any() -> pop_result;
 
         void notify_one_sleeping();
         void set_stealing();
@@ -622,11 +829,12 @@ namespace exec {
 
         bwos::lifo_queue<task_base*, numa_allocator<task_base*>> local_queue_;
         __intrusive_queue<&task_base::next> pending_queue_{};
+        //! Receives the tasks of a block that is stolen at once.
+        std::vector<task_base*> stolen_;
         std::mutex mut_{};
         std::condition_variable cv_{};
         bool stopRequested_{false};
-        std::vector<workstealing_victim> near_victims_{};
-        std::vector<workstealing_victim> all_victims_{};
+        std::array<std::vector<workstealing_victim>, steal_level_count> rings_{};
         std::atomic<state> state_;
         static_thread_pool_* pool_;
         xorshift rng_{};
@@ -638,11 +846,12 @@ namespace exec {
       alignas(64) std::atomic<std::uint32_t> numActive_{};
       alignas(64) remote_queue_list remotes_;
       std::uint32_t threadCount_;
-      std::uint32_t maxSteals_{threadCount_ + 1};
+      std::array<std::uint32_t, steal_level_count> maxSteals_{};
       bwos_params params_;
       std::vector<std::thread> threads_;
       std::vector<std::optional<thread_state>> threadStates_;
       numa_policy numa_;
+      std::vector<std::unique_ptr<numa_pool_resource>> memoryResources_;
 
       struct thread_index_by_numa_node {
         int numa_node;
@@ -662,6 +871,14 @@ namespace exec {
       };
 
       std::vector<thread_index_by_numa_node> threadIndexByNumaNode_;
+      //! The number of threads on the NUMA nodes before each node, and in total at the end.
+      std::vector<std::size_t> threadsBeforeNode_;
+      //! The position of each thread among the threads of its NUMA node.
+      std::vector<std::uint32_t> threadRankInNode_;
+      topology_params topology_;
+      //! The CPU that each thread is placed on, with a CPU number of -1 if it is unknown, and the
+      //! NUMA node of the thread.
+      std::vector<cpu_info> threadCpus_;
 
       [[nodiscard]]
       auto num_threads(int numa) const noexcept -> std::size_t;
@@ -679,14 +896,21 @@ namespace exec {
     inline static_thread_pool_::static_thread_pool_(
       std::uint32_t threadCount,
       bwos_params params,
-      numa_policy numa)
+      numa_policy numa,
+      topology_params topology)
       : remotes_(threadCount)
       , threadCount_(threadCount)
       , params_(params)
       , threadStates_(threadCount)
-      , numa_(std::move(numa)) {
+      , numa_(std::move(numa))
+      , topology_(std::move(topology)) {
       STDEXEC_ASSERT(threadCount > 0);
 
+      for (std::size_t level = 0; level < steal_level_count; ++level) {
+        const std::uint32_t attempts = topology_.steal_attempts[level];
+        maxSteals_[level] = attempts != 0 ? attempts : threadCount_ + 1;
+      }
+
       for (std::uint32_t index = 0; index < threadCount; ++index) {
         threadStates_[index].emplace(this, index, params, numa_);
         threadIndexByNumaNode_.push_back(thread_index_by_numa_node{
@@ -695,6 +919,31 @@ namespace exec {
 
       // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
       std::sort(threadIndexByNumaNode_.begin(), threadIndexByNumaNode_.end());
+      const int nNodes = threadIndexByNumaNode_.back().numa_node + 1;
+      for (int node = 0; node < nNodes; ++node) {
+        memoryResources_.push_back(std::make_unique<numa_pool_resource>(node));
+      }
+      threadsBeforeNode_.resize(static_cast<std::size_t>(nNodes) + 1);
+      for (auto& state: threadStates_) {
+        const auto node = static_cast<std::size_t>(state->numa_node());
+        threadRankInNode_.push_back(static_cast<std::uint32_t>(threadsBeforeNode_[node + 1]++));
+      }
+      // NOLINTNEXTLINE(modernize-use-ranges) we still support platforms without the std::ranges algorithms
+      std::partial_sum(
+        threadsBeforeNode_.begin(), threadsBeforeNode_.end(), threadsBeforeNode_.begin());
+      // The threads of a node are placed on the CPUs of the node in order.
+      for (auto& state: threadStates_) {
+        if (topology_.topology.empty()) {
+          threadCpus_.push_back(
+            cpu_info{.cpu = -1, .core = -1, .l3 = -1, .node = state->numa_node()});
+        } else {
+          const std::vector<cpu_info> cpus = topology_.topology.cpus_of_node(state->numa_node());
+          cpu_info cpu = cpus[threadRankInNode_[state->index()] % cpus.size()];
+          // Victims are sorted by the node that the NUMA policy assigns to their thread.
+          cpu.node = state->numa_node();
+          threadCpus_.push_back(cpu);
+        }
+      }
       std::vector<workstealing_victim> victims{};
       for (auto& state: threadStates_) {
         victims.emplace_back(state->as_victim());
@@ -731,12 +980,18 @@ namespace exec {
       STDEXEC_ASSERT(threadIndex < threadCount_);
       // NOLINTNEXTLINE(bugprone-unused-return-value)
       numa_.bind_to_node(threadStates_[threadIndex]->numa_node());
+      if (topology_.pin_threads && threadCpus_[threadIndex].cpu >= 0) {
+        // NOLINTNEXTLINE(bugprone-unused-return-value)
+        pin_this_thread_to_cpu(threadCpus_[threadIndex].cpu);
+      }
       while (true) {
         // Make a blocking call to de-queue a task if we don't already have one.
         auto [task, queueIndex] = threadStates_[threadIndex]->pop();
         if (!task) {
           return; // pop() only returns null when request_stop() was called.
         }
+        __trace::__record(trace_event::dequeue, "static_thread_pool", queueIndex);
+        __task_clock::__note_task_begin();
         task->__execute(task, queueIndex);
       }
     }
@@ -820,12 +1075,14 @@ namespace exec {
       if (idx < threadStates_.size()) {
         auto this_node = static_cast<std::size_t>(threadStates_[idx]->numa_node());
         if (constraints[this_node]) {
+          __trace::__record(trace_event::enqueue, "static_thread_pool", idx);
           threadStates_[idx]->push_local(task);
           return;
         }
       }
 
       const std::size_t threadIndex = random_thread_index_with_constraints(constraints);
+      __trace::__record(trace_event::enqueue, "static_thread_pool", threadIndex);
       queue.queues_[threadIndex].push_front(task);
       threadStates_[threadIndex]->notify();
     }
@@ -835,6 +1092,7 @@ namespace exec {
       task_base* task,
       std::size_t threadIndex) noexcept {
       threadIndex %= threadCount_;
+      __trace::__record(trace_event::enqueue, "static_thread_pool", threadIndex);
       queue.queues_[threadIndex].push_front(task);
       threadStates_[threadIndex]->notify();
     }
@@ -844,6 +1102,7 @@ namespace exec {
       auto& queue = *this->get_remote_queue();
       for (std::uint32_t i = 0; i < n_threads; ++i) {
         std::uint32_t index = i % this->available_parallelism();
+        __trace::__record(trace_event::enqueue, "static_thread_pool", index);
         queue.queues_[index].push_front(task + i);
         threadStates_[index]->notify();
       }
@@ -863,6 +1122,7 @@ namespace exec {
       if (idx < threadStates_.size()) {
         auto this_node = static_cast<std::size_t>(threadStates_[idx]->numa_node());
         if (constraints[this_node]) {
+          __trace::__record(trace_event::enqueue, "static_thread_pool", idx);
           threadStates_[idx]->push_local(std::move(tasks));
           return;
         }
@@ -879,6 +1139,7 @@ namespace exec {
         for (std::size_t j = i0; j < iEnd; ++j) {
           tmp.push_back(tasks.pop_front());
         }
+        __trace::__record(trace_event::enqueue, "static_thread_pool", i);
         correct_queue->queues_[i].prepend(std::move(tmp));
         threadStates_[i]->notify();
       }
@@ -925,17 +1186,21 @@ namespace exec {
         0, static_cast<std::uint32_t>(victims.size() - 1));
       std::uint32_t victimIndex = dist(rng_);
       auto& v = victims[victimIndex];
-      return {.task = v.try_steal(), .queueIndex = v.index()};
-    }
-
-    inline auto static_thread_pool_::thread_state::try_steal_near()
-      -> static_thread_pool_::thread_state::pop_result {
-      return try_steal(near_victims_);
-    }
-
-    inline auto static_thread_pool_::thread_state::try_steal_any()
-      -> static_thread_pool_::thread_state::pop_result {
-      return try_steal(all_victims_);
+      // Take a whole block, so that a thief that found a busy victim does not have to come back
+      // for every single task. It runs the oldest one and keeps the others in its own queue.
+      auto last = v.try_steal(stolen_.begin(), stolen_.size());
+      if (last == stolen_.begin()) {
+        return {.task = nullptr, .queueIndex = v.index()};
+      }
+      __trace::__record(trace_event::steal, "static_thread_pool", v.index());
+      if (v.numa_node() != numa_node_) {
+        pool_->numa_.remote_access(numa_node_, v.numa_node());
+      }
+      auto first = stolen_.begin() + 1;
+      for (first = local_queue_.push_back(first, last); first != last; ++first) {
+        pending_queue_.push_back(*first);
+      }
+      return {.task = stolen_.front(), .queueIndex = v.index()};
     }
 
     inline void static_thread_pool_::thread_state::push_local(task_base* task) {
@@ -997,19 +1262,16 @@ namespace exec {
       pop_result result = try_pop();
       while (!result.task) {
         set_stealing();
-        for (std::size_t i = 0; i < pool_->maxSteals_; ++i) {
-          result = try_steal_near();
-          if (result.task) {
-            clear_stealing();
-            return result;
+        for (std::size_t level = 0; level < steal_level_count; ++level) {
+          if (__topology::__skips_steal_ring(rings_, level)) {
+            continue;
           }
-        }
-
-        for (std::size_t i = 0; i < pool_->maxSteals_; ++i) {
-          result = try_steal_any();
-          if (result.task) {
-            clear_stealing();
-            return result;
+          for (std::size_t i = 0; i < pool_->maxSteals_[level]; ++i) {
+            result = try_steal(rings_[level]);
+            if (result.task) {
+              clear_stealing();
+              return result;
+            }
           }
         }
         std::this_thread::yield();
@@ -1026,8 +1288,10 @@ namespace exec {
             return result;
           }
           set_sleeping();
+          __trace::__record(trace_event::sleep, "static_thread_pool", index_);
           cv_.wait(lock);
           lock.unlock();
+          __trace::__record(trace_event::wake, "static_thread_pool", index_);
           clear_sleeping();
         }
         if (lock.owns_lock()) {
@@ -1184,15 +1448,19 @@ namespace exec {
 
         bulk_task(bulk_shared_state* sh_state)
           : sh_state_(sh_state) {
-          this->__execute = [](task_base* t, const std::uint32_t tid) noexcept {
-            auto& sh_state = *static_cast<bulk_task*>(t)->sh_state_;
+          this->__execute = [](task_base* t, std::uint32_t /* tid */) noexcept {
+            auto* task = static_cast<bulk_task*>(t);
+            auto& sh_state = *task->sh_state_;
             auto total_threads = sh_state.num_agents_required();
+            // Thieves steal tasks in batches and run them from their own queue, so a task knows
+            // its agent by its position rather than by the queue that it was taken from.
+            auto tid = static_cast<std::uint32_t>(task - sh_state.tasks_.data());
 
             auto computation = [&](auto&... args) {
               // Each computation does one or more call to the the bulk function.
               // In the case that the shape is much larger than the total number of threads,
               // then each call to computation will call the function many times.
-              auto [begin, end] = even_share(sh_state.shape_, tid, total_threads);
+              auto [begin, end] = sh_state.share(tid);
               sh_state.fun_(begin, end, args...);
             };
 
@@ -1253,7 +1521,7 @@ namespace exec {
       std::atomic<std::uint32_t> finished_threads_{0};
       std::atomic<std::uint32_t> thread_with_exception_{0};
       std::exception_ptr exception_;
-      std::vector<bulk_task> tasks_;
+      std::vector<bulk_task, std::pmr::polymorphic_allocator<bulk_task>> tasks_;
 
       //! The number of agents required is the minimum of `shape_` and the available parallelism.
       //! That is, we don't need an agent for each of the shape values.
@@ -1267,6 +1535,18 @@ namespace exec {
         }
       }
 
+      //! Returns the part of the shape that the agent works on. If there is an agent for each
+      //! thread of the pool, it works on the data of the NUMA node of the thread whose queue the
+      //! agent was enqueued to.
+      [[nodiscard]]
+      auto share(std::uint32_t tid) const noexcept -> std::pair<Shape, Shape> {
+        const std::uint32_t total_threads = num_agents_required();
+        if (total_threads == pool_.available_parallelism()) {
+          return pool_.bulk_share(shape_, tid);
+        }
+        return even_share(shape_, tid, total_threads);
+      }
+
       template <class F>
       void apply(F f) {
         std::visit(
@@ -1281,14 +1561,15 @@ namespace exec {
       }
 
       //! Construct from a pool, receiver, shape, and function.
-      //! Allocates O(min(shape, available_parallelism())) memory.
+      //! Allocates O(min(shape, available_parallelism())) memory from the memory resource of the
+      //! pool for the NUMA node of the calling thread.
       bulk_shared_state(static_thread_pool_& pool, Receiver rcvr, Shape shape, Fun fun)
         : pool_{pool}
         , rcvr_{static_cast<Receiver&&>(rcvr)}
         , shape_{shape}
         , fun_{fun}
         , thread_with_exception_{num_agents_required()}
-        , tasks_{num_agents_required(), {this}} {
+        , tasks_{num_agents_required(), {this}, &pool.get_memory_resource()} {
       }
     };
 
@@ -1387,20 +1668,851 @@ namespace exec {
       }
     };
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////
+    // What follows is the implementation for parallel reductions on static_thread_pool_.
+    template <class SenderId, class Init, class Fun>
+    struct static_thread_pool_::reduce_sender<SenderId, Init, Fun>::__t {
+      using __id = reduce_sender;
+      using sender_concept = sender_t;
+
+      static_thread_pool_& pool_;
+      Sender sndr_;
+      Init init_;
+      Fun fun_;
+
+      template <class Self, class... Env>
+      using __completions_t =
+        exec::__reduce::__completions_t<__copy_cvref_t<Self, Sender>, Init, Fun, Env...>;
+
+      template <class Self, class Receiver>
+      using reduce_op_state_t = //
+        stdexec::__t<
+          reduce_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, Init, Fun>>;
+
+      template <__decays_to<__t> Self, receiver Receiver>
+        requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
+      static auto connect(Self&& self, Receiver rcvr) -> reduce_op_state_t<Self, Receiver> {
+        return reduce_op_state_t<Self, Receiver>{
+          self.pool_,
+          static_cast<Self&&>(self).init_,
+          static_cast<Self&&>(self).fun_,
+          static_cast<Self&&>(self).sndr_,
+          static_cast<Receiver&&>(rcvr)};
+      }
+
+      template <__decays_to<__t> Self, class... Env>
+      static auto get_completion_signatures(Self&&, Env&&...) -> __completions_t<Self, Env...> {
+        return {};
+      }
+
+      auto get_env() const noexcept -> env_of_t<const Sender&> {
+        return stdexec::get_env(sndr_);
+      }
+    };
+
+    //! The shared state of a parallel reduction. Each task folds a contiguous slice of the
+    //! range into its own cache-line-padded partial. The partials are then combined pairwise
+    //! along a binary tree: the second of two siblings to arrive at a node combines both
+    //! partials and carries the result one level up, so no task ever waits for another.
+    template <class CvrefSender, class Receiver, class Init, class Fun>
+    struct static_thread_pool_::reduce_shared_state {
+      using range_t = __decay_t<__single_sender_value_t<CvrefSender, env_of_t<Receiver>>>;
+      using iterator_t = decltype(std::begin(__declval<range_t&>()));
+      using reference_t = exec::__reduce::__range_reference_t<range_t>;
+
+      //! Ranges that do not give every task at least this many items are reduced sequentially.
+      static constexpr std::size_t min_items_per_task = 2048;
+
+      //! A task's partial starts from its first item, so the items must be convertible to the
+      //! result type. Otherwise, and for ranges without random access, we reduce sequentially.
+      static constexpr bool parallelizable = std::random_access_iterator<iterator_t>
+                                          && std::constructible_from<Init, reference_t>;
+
+      struct reduce_task : task_base {
+        reduce_shared_state* sh_state_;
+
+        explicit reduce_task(reduce_shared_state* sh_state) noexcept
+          : sh_state_(sh_state) {
+          this->__execute = [](task_base* t, std::uint32_t) noexcept {
+            auto* self = static_cast<reduce_task*>(t);
+            auto& sh_state = *self->sh_state_;
+            sh_state.execute(static_cast<std::uint32_t>(self - sh_state.tasks_.data()));
+          };
+        }
+      };
+
+      struct alignas(bwos::hardware_destructive_interference_size) partial {
+        std::optional<Init> value_;
+      };
+
+      static_thread_pool_& pool_;
+      Receiver rcvr_;
+      Init init_;
+      Fun fun_;
+      std::optional<range_t> range_;
+      std::size_t size_{};
+      std::uint32_t n_tasks_{};
+      std::vector<reduce_task> tasks_;
+      std::vector<partial> partials_;
+      std::unique_ptr<std::atomic<std::uint8_t>[]> arrivals_;
+      std::atomic<bool> has_exception_{false};
+      std::exception_ptr exception_;
+
+      reduce_shared_state(static_thread_pool_& pool, Receiver rcvr, Init init, Fun fun)
+        : pool_{pool}
+        , rcvr_{static_cast<Receiver&&>(rcvr)}
+        , init_{static_cast<Init&&>(init)}
+        , fun_{static_cast<Fun&&>(fun)} {
+      }
+
+      template <class Range>
+      void start(Range&& range) noexcept {
+        try {
+          range_.emplace(static_cast<Range&&>(range));
+          if constexpr (parallelizable) {
+            size_ = static_cast<std::size_t>(std::end(*range_) - std::begin(*range_));
+            n_tasks_ = static_cast<std::uint32_t>(
+              std::min<std::size_t>(pool_.available_parallelism(), size_ / min_items_per_task));
+          }
+          if (n_tasks_ < 2) {
+            stdexec::set_value(
+              static_cast<Receiver&&>(rcvr_),
+              exec::__reduce::__sequential_reduce(*range_, std::move(init_), fun_));
+            return;
+          }
+          // A tree over n leaves has n - 1 inner nodes.
+          partials_ = std::vector<partial>(n_tasks_);
+          arrivals_ = std::make_unique<std::atomic<std::uint8_t>[]>(n_tasks_ - 1);
+          tasks_.reserve(n_tasks_);
+          for (std::uint32_t i = 0; i < n_tasks_; ++i) {
+            tasks_.emplace_back(this);
+          }
+        } catch (...) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::current_exception());
+          return;
+        }
+        pool_.bulk_enqueue(tasks_.data(), n_tasks_);
+      }
+
+      void execute(std::uint32_t index) noexcept {
+        if constexpr (parallelizable) {
+          using difference_t = std::iter_difference_t<iterator_t>;
+          auto [begin, end] = even_share(size_, index, n_tasks_);
+          try {
+            auto first = std::begin(*range_) + static_cast<difference_t>(begin);
+            auto last = std::begin(*range_) + static_cast<difference_t>(end);
+            Init acc(*first);
+            for (++first; first != last; ++first) {
+              acc = fun_(std::move(acc), *first);
+            }
+            partials_[index].value_.emplace(std::move(acc));
+          } catch (...) {
+            set_exception();
+          }
+          combine_up(index);
+        }
+      }
+
+      //! Walks up the combining tree from the leaf `index`. At level `l` the partial of slot
+      //! `left` is combined with the partial of slot `left + 2^l`.
+      void combine_up(std::uint32_t index) noexcept {
+        std::uint32_t offset = 0;
+        std::uint32_t count = n_tasks_;
+        for (std::uint32_t stride = 1; stride < n_tasks_; stride *= 2) {
+          const std::uint32_t left = index - index % (2 * stride);
+          const std::uint32_t right = left + stride;
+          if (right < n_tasks_) {
+            auto& arrivals = arrivals_[offset + left / (2 * stride)];
+            if (arrivals.fetch_add(1, std::memory_order_acq_rel) == 0) {
+              // The sibling is still running and will carry our partial upwards.
+              return;
+            }
+            combine(partials_[left], partials_[right]);
+          }
+          index = left;
+          offset += count / 2;
+          count -= count / 2;
+        }
+        complete();
+      }
+
+      void combine(partial& left, partial& right) noexcept {
+        if (!right.value_) {
+          return;
+        }
+        if (!left.value_) {
+          left.value_ = std::move(right.value_);
+          return;
+        }
+        try {
+          *left.value_ = fun_(std::move(*left.value_), std::move(*right.value_));
+        } catch (...) {
+          set_exception();
+        }
+      }
+
+      void complete() noexcept {
+        if (has_exception_.load(std::memory_order_relaxed)) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::move(exception_));
+          return;
+        }
+        try {
+          Init result(fun_(std::move(init_), std::move(*partials_[0].value_)));
+          stdexec::set_value(static_cast<Receiver&&>(rcvr_), std::move(result));
+        } catch (...) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::current_exception());
+        }
+      }
+
+      void set_exception() noexcept {
+        if (!has_exception_.exchange(true, std::memory_order_relaxed)) {
+          exception_ = std::current_exception();
+        }
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Init, class Fun>
+    struct static_thread_pool_::reduce_receiver<CvrefSenderId, ReceiverId, Init, Fun>::__t {
+      using __id = reduce_receiver;
+      using receiver_concept = receiver_t;
+
+      using shared_state = reduce_shared_state<CvrefSender, Receiver, Init, Fun>;
+
+      shared_state& shared_state_;
+
+      template <class Range>
+      void set_value(Range&& range) noexcept {
+        shared_state_.start(static_cast<Range&&>(range));
+      }
+
+      template <class Error>
+      void set_error(Error&& error) noexcept {
+        stdexec::set_error(
+          static_cast<Receiver&&>(shared_state_.rcvr_), static_cast<Error&&>(error));
+      }
+
+      void set_stopped() noexcept {
+        stdexec::set_stopped(static_cast<Receiver&&>(shared_state_.rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<Receiver> {
+        return stdexec::get_env(shared_state_.rcvr_);
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Init, class Fun>
+    struct static_thread_pool_::reduce_op_state<CvrefSenderId, ReceiverId, Init, Fun>::__t {
+      using __id = reduce_op_state;
+
+      using shared_state = reduce_shared_state<CvrefSender, Receiver, Init, Fun>;
+      using reduce_rcvr = stdexec::__t<
+        reduce_receiver<__cvref_id<CvrefSender>, stdexec::__id<Receiver>, Init, Fun>>;
+      using inner_op_state = connect_result_t<CvrefSender, reduce_rcvr>;
+
+      shared_state shared_state_;
+
+      inner_op_state inner_op_;
+
+      void start() & noexcept {
+        stdexec::start(inner_op_);
+      }
+
+      __t(static_thread_pool_& pool, Init init, Fun fun, CvrefSender&& sndr, Receiver rcvr)
+        : shared_state_(
+            pool,
+            static_cast<Receiver&&>(rcvr),
+            static_cast<Init&&>(init),
+            static_cast<Fun&&>(fun))
+        , inner_op_{
+            stdexec::connect(static_cast<CvrefSender&&>(sndr), reduce_rcvr{shared_state_})} {
+      }
+    };
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////
+    // What follows is the implementation for parallel scans on static_thread_pool_.
+    template <class SenderId, class Data>
+    struct static_thread_pool_::scan_sender<SenderId, Data>::__t {
+      using __id = scan_sender;
+      using sender_concept = sender_t;
+
+      static_thread_pool_& pool_;
+      Sender sndr_;
+      Data data_;
+
+      template <class Self, class... Env>
+      using __completions_t = exec::__scan::__completions_t<__copy_cvref_t<Self, Sender>, Env...>;
+
+      template <class Self, class Receiver>
+      using scan_op_state_t = //
+        stdexec::__t<scan_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, Data>>;
+
+      template <__decays_to<__t> Self, receiver Receiver>
+        requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
+      static auto connect(Self&& self, Receiver rcvr) -> scan_op_state_t<Self, Receiver> {
+        return scan_op_state_t<Self, Receiver>{
+          self.pool_,
+          static_cast<Self&&>(self).data_,
+          static_cast<Self&&>(self).sndr_,
+          static_cast<Receiver&&>(rcvr)};
+      }
+
+      template <__decays_to<__t> Self, class... Env>
+      static auto get_completion_signatures(Self&&, Env&&...) -> __completions_t<Self, Env...> {
+        return {};
+      }
+
+      auto get_env() const noexcept -> env_of_t<const Sender&> {
+        return stdexec::get_env(sndr_);
+      }
+    };
+
+    //! The shared state of a parallel scan, which runs in two passes over the same tasks. In
+    //! the first pass each task reduces its block of the input. The last task to finish turns
+    //! the block sums into the prefix of each block and enqueues the tasks again. In the second
+    //! pass each task scans its block, starting from the block's prefix.
+    template <class CvrefSender, class Receiver, class Data>
+    struct static_thread_pool_::scan_shared_state {
+      using ranges_t = __value_types_of_t<
+        CvrefSender,
+        env_of_t<Receiver>,
+        __q<__decayed_std_tuple>,
+        __q<__msingle>>;
+      using init_t = decltype(Data::__init_);
+      using in_range_t = std::tuple_element_t<0, ranges_t>;
+      using in_iterator_t = decltype(std::begin(__declval<in_range_t&>()));
+      using out_range_t = std::tuple_element_t<std::tuple_size_v<ranges_t> - 1, ranges_t>;
+      using out_iterator_t = decltype(std::begin(__declval<out_range_t&>()));
+      using acc_t = exec::__scan::__accumulator_t<init_t, in_range_t>;
+
+      static constexpr bool inclusive = same_as<init_t, exec::__scan::__no_init>;
+
+      //! Ranges that do not give every task at least this many items are scanned sequentially.
+      static constexpr std::size_t min_items_per_task = 2048;
+
+      static constexpr bool parallelizable =
+        std::random_access_iterator<in_iterator_t> && std::random_access_iterator<out_iterator_t>
+        && std::constructible_from<acc_t, std::iter_reference_t<in_iterator_t>>;
+
+      struct scan_task : task_base {
+        scan_shared_state* sh_state_;
+
+        explicit scan_task(scan_shared_state* sh_state) noexcept
+          : sh_state_(sh_state) {
+          this->__execute = [](task_base* t, std::uint32_t) noexcept {
+            auto* self = static_cast<scan_task*>(t);
+            auto& sh_state = *self->sh_state_;
+            sh_state.execute(static_cast<std::uint32_t>(self - sh_state.tasks_.data()));
+          };
+        }
+      };
+
+      struct alignas(bwos::hardware_destructive_interference_size) partial {
+        std::optional<acc_t> value_;
+      };
+
+      static_thread_pool_& pool_;
+      Receiver rcvr_;
+      Data data_;
+      std::optional<ranges_t> ranges_;
+      std::size_t size_{};
+      std::uint32_t n_tasks_{};
+      bool scanning_{false};
+      std::vector<scan_task> tasks_;
+      std::vector<partial> partials_;
+      std::atomic<std::uint32_t> finished_tasks_{0};
+      std::atomic<bool> has_exception_{false};
+      std::exception_ptr exception_;
+
+      scan_shared_state(static_thread_pool_& pool, Receiver rcvr, Data data)
+        : pool_{pool}
+        , rcvr_{static_cast<Receiver&&>(rcvr)}
+        , data_{static_cast<Data&&>(data)} {
+      }
+
+      auto in() noexcept -> in_range_t& {
+        return std::get<0>(*ranges_);
+      }
+
+      auto out() noexcept -> out_range_t& {
+        return std::get<std::tuple_size_v<ranges_t> - 1>(*ranges_);
+      }
+
+      template <class... Ranges>
+      void start(Ranges&&... ranges) noexcept {
+        try {
+          ranges_.emplace(static_cast<Ranges&&>(ranges)...);
+          if constexpr (parallelizable) {
+            size_ = static_cast<std::size_t>(std::end(in()) - std::begin(in()));
+            n_tasks_ = static_cast<std::uint32_t>(
+              std::min<std::size_t>(pool_.available_parallelism(), size_ / min_items_per_task));
+          }
+          if (n_tasks_ < 2) {
+            exec::__scan::__sequential_scan(in(), out(), std::move(data_.__init_), data_.__fun_);
+            stdexec::set_value(static_cast<Receiver&&>(rcvr_), std::move(out()));
+            return;
+          }
+          partials_ = std::vector<partial>(n_tasks_);
+          tasks_.reserve(n_tasks_);
+          for (std::uint32_t i = 0; i < n_tasks_; ++i) {
+            tasks_.emplace_back(this);
+          }
+        } catch (...) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::current_exception());
+          return;
+        }
+        pool_.bulk_enqueue(tasks_.data(), n_tasks_);
+      }
+
+      void execute(std::uint32_t index) noexcept {
+        if constexpr (parallelizable) {
+          using in_difference_t = std::iter_difference_t<in_iterator_t>;
+          using out_difference_t = std::iter_difference_t<out_iterator_t>;
+          auto [begin, end] = even_share(size_, index, n_tasks_);
+          auto first = std::begin(in()) + static_cast<in_difference_t>(begin);
+          auto last = std::begin(in()) + static_cast<in_difference_t>(end);
+          try {
+            if (!scanning_) {
+              // The sum of the last block does not contribute to any prefix.
+              if (index + 1 < n_tasks_) {
+                partials_[index].value_.emplace(
+                  exec::__scan::__reduce_block<acc_t>(first, last, data_.__fun_));
+              }
+            } else {
+              exec::__scan::__scan_block<inclusive, acc_t>(
+                first,
+                last,
+                std::begin(out()) + static_cast<out_difference_t>(begin),
+                std::move(partials_[index].value_),
+                data_.__fun_);
+            }
+          } catch (...) {
+            if (!has_exception_.exchange(true, std::memory_order_relaxed)) {
+              exception_ = std::current_exception();
+            }
+          }
+          // Once the last task has finished, the shared state may be gone.
+          const std::uint32_t n_tasks = n_tasks_;
+          if (finished_tasks_.fetch_add(1, std::memory_order_acq_rel) == n_tasks - 1) {
+            if (scanning_ || has_exception_.load(std::memory_order_relaxed)) {
+              complete();
+            } else {
+              scan();
+            }
+          }
+        }
+      }
+
+      //! Replaces the block sums by the block prefixes and starts the second pass.
+      void scan() noexcept {
+        try {
+          std::optional<acc_t> prefix;
+          if constexpr (!inclusive) {
+            prefix.emplace(std::move(data_.__init_));
+          }
+          for (std::uint32_t i = 0; i < n_tasks_; ++i) {
+            std::optional<acc_t> sum = std::exchange(partials_[i].value_, prefix);
+            if (i + 1 < n_tasks_) {
+              prefix = prefix ? acc_t(data_.__fun_(std::move(*prefix), std::move(*sum)))
+                              : std::move(sum);
+            }
+          }
+        } catch (...) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::current_exception());
+          return;
+        }
+        scanning_ = true;
+        finished_tasks_.store(0, std::memory_order_relaxed);
+        pool_.bulk_enqueue(tasks_.data(), n_tasks_);
+      }
+
+      void complete() noexcept {
+        if (has_exception_.load(std::memory_order_relaxed)) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::move(exception_));
+        } else {
+          stdexec::set_value(static_cast<Receiver&&>(rcvr_), std::move(out()));
+        }
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Data>
+    struct static_thread_pool_::scan_receiver<CvrefSenderId, ReceiverId, Data>::__t {
+      using __id = scan_receiver;
+      using receiver_concept = receiver_t;
+
+      using shared_state = scan_shared_state<CvrefSender, Receiver, Data>;
+
+      shared_state& shared_state_;
+
+      template <class... Ranges>
+      void set_value(Ranges&&... ranges) noexcept {
+        shared_state_.start(static_cast<Ranges&&>(ranges)...);
+      }
+
+      template <class Error>
+      void set_error(Error&& error) noexcept {
+        stdexec::set_error(
+          static_cast<Receiver&&>(shared_state_.rcvr_), static_cast<Error&&>(error));
+      }
+
+      void set_stopped() noexcept {
+        stdexec::set_stopped(static_cast<Receiver&&>(shared_state_.rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<Receiver> {
+        return stdexec::get_env(shared_state_.rcvr_);
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Data>
+    struct static_thread_pool_::scan_op_state<CvrefSenderId, ReceiverId, Data>::__t {
+      using __id = scan_op_state;
+
+      using shared_state = scan_shared_state<CvrefSender, Receiver, Data>;
+      using scan_rcvr =
+        stdexec::__t<scan_receiver<__cvref_id<CvrefSender>, stdexec::__id<Receiver>, Data>>;
+      using inner_op_state = connect_result_t<CvrefSender, scan_rcvr>;
+
+      shared_state shared_state_;
+
+      inner_op_state inner_op_;
+
+      void start() & noexcept {
+        stdexec::start(inner_op_);
+      }
+
+      __t(static_thread_pool_& pool, Data data, CvrefSender&& sndr, Receiver rcvr)
+        : shared_state_(pool, static_cast<Receiver&&>(rcvr), static_cast<Data&&>(data))
+        , inner_op_{stdexec::connect(static_cast<CvrefSender&&>(sndr), scan_rcvr{shared_state_})} {
+      }
+    };
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////
+    // What follows is the implementation for parallel sorting on static_thread_pool_.
+    template <class SenderId, class Comp>
+    struct static_thread_pool_::sort_sender<SenderId, Comp>::__t {
+      using __id = sort_sender;
+      using sender_concept = sender_t;
+
+      static_thread_pool_& pool_;
+      Sender sndr_;
+      Comp comp_;
+
+      template <class Self, class... Env>
+      using __completions_t = exec::__sort::__completions_t<__copy_cvref_t<Self, Sender>, Env...>;
+
+      template <class Self, class Receiver>
+      using sort_op_state_t = //
+        stdexec::__t<sort_op_state<__cvref_id<Self, Sender>, stdexec::__id<Receiver>, Comp>>;
+
+      template <__decays_to<__t> Self, receiver Receiver>
+        requires receiver_of<Receiver, __completions_t<Self, env_of_t<Receiver>>>
+      static auto connect(Self&& self, Receiver rcvr) -> sort_op_state_t<Self, Receiver> {
+        return sort_op_state_t<Self, Receiver>{
+          self.pool_,
+          static_cast<Self&&>(self).comp_,
+          static_cast<Self&&>(self).sndr_,
+          static_cast<Receiver&&>(rcvr)};
+      }
+
+      template <__decays_to<__t> Self, class... Env>
+      static auto get_completion_signatures(Self&&, Env&&...) -> __completions_t<Self, Env...> {
+        return {};
+      }
+
+      auto get_env() const noexcept -> env_of_t<const Sender&> {
+        return stdexec::get_env(sndr_);
+      }
+    };
+
+    //! The shared state of a parallel sort. The range is split into a power-of-two number of
+    //! blocks, one per task. The tasks first sort their own blocks and then run one pass per
+    //! level of a merge tree, each of which merges pairs of sorted runs into runs twice as
+    //! long, ping-ponging between the range and a scratch buffer. Within a merge, the tasks
+    //! split the output evenly by locating their slice on the merge path, so every task
+    //! always writes the same slice of the range and of the buffer. Task `i` is enqueued on
+    //! the `i`-th worker, whose NUMA node is given by the pool's `numa_policy`, so the pages of
+    //! each slice tend to be first touched and then repeatedly written on the same node. This
+    //! is a placement heuristic, not a guarantee: idle workers steal tasks, and with them the
+    //! slices that those tasks write.
+    template <class CvrefSender, class Receiver, class Comp>
+    struct static_thread_pool_::sort_shared_state {
+      using range_t = __decay_t<__single_sender_value_t<CvrefSender, env_of_t<Receiver>>>;
+      using iterator_t = decltype(std::begin(__declval<range_t&>()));
+      using difference_t = std::iter_difference_t<iterator_t>;
+      using value_t = std::iter_value_t<iterator_t>;
+
+      //! Ranges that do not give every task at least this many items are sorted sequentially.
+      static constexpr std::size_t min_items_per_task = 2048;
+
+      //! The scratch buffer is constructed by the tasks, which must not throw while doing so.
+      static constexpr bool parallelizable = std::random_access_iterator<iterator_t>
+                                          && std::is_nothrow_default_constructible_v<value_t>
+                                          && std::is_nothrow_move_constructible_v<value_t>
+                                          && std::is_move_assignable_v<value_t>;
+
+      struct sort_task : task_base {
+        sort_shared_state* sh_state_;
+
+        explicit sort_task(sort_shared_state* sh_state) noexcept
+          : sh_state_(sh_state) {
+          this->__execute = [](task_base* t, std::uint32_t) noexcept {
+            auto* self = static_cast<sort_task*>(t);
+            auto& sh_state = *self->sh_state_;
+            sh_state.execute(static_cast<std::uint32_t>(self - sh_state.tasks_.data()));
+          };
+        }
+      };
+
+      static_thread_pool_& pool_;
+      Receiver rcvr_;
+      Comp comp_;
+      std::optional<range_t> range_;
+      std::size_t size_{};
+      std::uint32_t n_tasks_{};
+      std::uint32_t n_levels_{};
+      std::uint32_t level_{};
+      value_t* buffer_{};
+      //! For each task, the range of the first sorted run that its slice of the current merge
+      //! pass takes elements from.
+      std::vector<std::pair<std::size_t, std::size_t>> splits_;
+      std::vector<sort_task> tasks_;
+      std::atomic<std::uint32_t> finished_tasks_{0};
+      std::atomic<bool> has_exception_{false};
+      std::exception_ptr exception_;
+
+      sort_shared_state(static_thread_pool_& pool, Receiver rcvr, Comp comp)
+        : pool_{pool}
+        , rcvr_{static_cast<Receiver&&>(rcvr)}
+        , comp_{static_cast<Comp&&>(comp)} {
+      }
+
+      template <class Range>
+      void start(Range&& range) noexcept {
+        try {
+          range_.emplace(static_cast<Range&&>(range));
+          if constexpr (parallelizable) {
+            size_ = static_cast<std::size_t>(std::end(*range_) - std::begin(*range_));
+            n_tasks_ = static_cast<std::uint32_t>(std::bit_floor(
+              std::min<std::size_t>(pool_.available_parallelism(), size_ / min_items_per_task)));
+            n_levels_ = static_cast<std::uint32_t>(std::countr_zero(n_tasks_));
+          }
+          if (n_tasks_ < 2) {
+            std::sort(std::begin(*range_), std::end(*range_), std::ref(comp_));
+            stdexec::set_value(static_cast<Receiver&&>(rcvr_), std::move(*range_));
+            return;
+          }
+          tasks_.reserve(n_tasks_);
+          for (std::uint32_t i = 0; i < n_tasks_; ++i) {
+            tasks_.emplace_back(this);
+          }
+          splits_.resize(n_tasks_);
+          buffer_ = std::allocator<value_t>().allocate(size_);
+        } catch (...) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::current_exception());
+          return;
+        }
+        pool_.bulk_enqueue(tasks_.data(), n_tasks_);
+      }
+
+      //! The first position of `block`, where block `n_tasks_` starts past the end.
+      [[nodiscard]]
+      auto block_begin(std::uint32_t block) const noexcept -> std::size_t {
+        return even_share(size_, block, n_tasks_).first;
+      }
+
+      //! Calls `fn` with the start of the input and output of the merge pass at `level`,
+      //! chosen such that the last pass writes to the range.
+      template <class Fn>
+      void with_merge_buffers(std::uint32_t level, Fn fn) {
+        if ((n_levels_ - level) % 2 == 0) {
+          fn(buffer_, std::begin(*range_));
+        } else {
+          fn(std::begin(*range_), buffer_);
+        }
+      }
+
+      void execute(std::uint32_t index) noexcept {
+        if constexpr (parallelizable) {
+          // Once the last task has finished, the shared state may be gone.
+          const std::uint32_t n_tasks = n_tasks_;
+          try {
+            if (level_ == 0) {
+              sort_block(index);
+            } else {
+              merge_slice(index);
+            }
+          } catch (...) {
+            if (!has_exception_.exchange(true, std::memory_order_relaxed)) {
+              exception_ = std::current_exception();
+            }
+          }
+          if (finished_tasks_.fetch_add(1, std::memory_order_acq_rel) == n_tasks - 1) {
+            if (level_ == n_levels_ || has_exception_.load(std::memory_order_relaxed)) {
+              complete();
+              return;
+            }
+            ++level_;
+            try {
+              split_merges();
+            } catch (...) {
+              exception_ = std::current_exception();
+              has_exception_.store(true, std::memory_order_relaxed);
+              complete();
+              return;
+            }
+            finished_tasks_.store(0, std::memory_order_relaxed);
+            pool_.bulk_enqueue(tasks_.data(), n_tasks_);
+          }
+        }
+      }
+
+      //! Sorts block `index` into where the first merge pass expects its input.
+      void sort_block(std::uint32_t index) {
+        auto [begin, end] = even_share(size_, index, n_tasks_);
+        auto first = std::begin(*range_) + static_cast<difference_t>(begin);
+        auto last = std::begin(*range_) + static_cast<difference_t>(end);
+        value_t* scratch = buffer_ + begin;
+        if (n_levels_ % 2 == 0) {
+          std::uninitialized_default_construct(scratch, scratch + (end - begin));
+          exec::__sort::__sort_block(first, last, scratch, comp_);
+        } else {
+          std::uninitialized_move(first, last, scratch);
+          exec::__sort::__sort_block(scratch, scratch + (end - begin), first, comp_);
+        }
+      }
+
+      //! The positions of the two sorted runs that slice `index` of the output of the current
+      //! merge pass is merged from.
+      [[nodiscard]]
+      auto runs_of(std::uint32_t index) const noexcept -> std::array<std::size_t, 3> {
+        const std::uint32_t blocks_per_run = 1u << level_;
+        const std::uint32_t first_block = index & ~(blocks_per_run - 1);
+        return {
+          block_begin(first_block),
+          block_begin(first_block + blocks_per_run / 2),
+          block_begin(first_block + blocks_per_run)};
+      }
+
+      //! Locates the slices of the current merge pass on the merge paths of their runs. This is
+      //! done up front, as the tasks move the elements out of their own slices while merging.
+      void split_merges() {
+        with_merge_buffers(level_, [&](auto input, auto) {
+          using input_difference_t = std::iter_difference_t<decltype(input)>;
+          for (std::uint32_t index = 0; index < n_tasks_; ++index) {
+            auto [run_begin, run_middle, run_end] = runs_of(index);
+            auto [begin, end] = even_share(size_, index, n_tasks_);
+            auto lhs = input + static_cast<input_difference_t>(run_begin);
+            auto rhs = input + static_cast<input_difference_t>(run_middle);
+            auto split = [&](std::size_t pos) {
+              return exec::__sort::__merge_path(
+                lhs, run_middle - run_begin, rhs, run_end - run_middle, pos - run_begin, comp_);
+            };
+            splits_[index] = {split(begin), split(end)};
+          }
+        });
+      }
+
+      //! Writes slice `index` of the merge of the two sorted runs that the slice falls in.
+      void merge_slice(std::uint32_t index) {
+        auto [run_begin, run_middle, run_end] = runs_of(index);
+        auto [begin, end] = even_share(size_, index, n_tasks_);
+        auto [lhs_first, lhs_last] = splits_[index];
+        const std::size_t rhs_first = begin - run_begin - lhs_first;
+        const std::size_t rhs_last = end - run_begin - lhs_last;
+        with_merge_buffers(level_, [&](auto input, auto output) {
+          using input_difference_t = std::iter_difference_t<decltype(input)>;
+          using output_difference_t = std::iter_difference_t<decltype(output)>;
+          auto lhs = input + static_cast<input_difference_t>(run_begin);
+          auto rhs = input + static_cast<input_difference_t>(run_middle);
+          std::merge(
+            std::make_move_iterator(lhs + static_cast<input_difference_t>(lhs_first)),
+            std::make_move_iterator(lhs + static_cast<input_difference_t>(lhs_last)),
+            std::make_move_iterator(rhs + static_cast<input_difference_t>(rhs_first)),
+            std::make_move_iterator(rhs + static_cast<input_difference_t>(rhs_last)),
+            output + static_cast<output_difference_t>(begin),
+            std::ref(comp_));
+        });
+      }
+
+      void complete() noexcept {
+        std::destroy_n(buffer_, size_);
+        std::allocator<value_t>().deallocate(std::exchange(buffer_, nullptr), size_);
+        if (has_exception_.load(std::memory_order_relaxed)) {
+          stdexec::set_error(static_cast<Receiver&&>(rcvr_), std::move(exception_));
+        } else {
+          stdexec::set_value(static_cast<Receiver&&>(rcvr_), std::move(*range_));
+        }
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Comp>
+    struct static_thread_pool_::sort_receiver<CvrefSenderId, ReceiverId, Comp>::__t {
+      using __id = sort_receiver;
+      using receiver_concept = receiver_t;
+
+      using shared_state = sort_shared_state<CvrefSender, Receiver, Comp>;
+
+      shared_state& shared_state_;
+
+      template <class Range>
+      void set_value(Range&& range) noexcept {
+        shared_state_.start(static_cast<Range&&>(range));
+      }
+
+      template <class Error>
+      void set_error(Error&& error) noexcept {
+        stdexec::set_error(
+          static_cast<Receiver&&>(shared_state_.rcvr_), static_cast<Error&&>(error));
+      }
+
+      void set_stopped() noexcept {
+        stdexec::set_stopped(static_cast<Receiver&&>(shared_state_.rcvr_));
+      }
+
+      auto get_env() const noexcept -> env_of_t<Receiver> {
+        return stdexec::get_env(shared_state_.rcvr_);
+      }
+    };
+
+    template <class CvrefSenderId, class ReceiverId, class Comp>
+    struct static_thread_pool_::sort_op_state<CvrefSenderId, ReceiverId, Comp>::__t {
+      using __id = sort_op_state;
+
+      using shared_state = sort_shared_state<CvrefSender, Receiver, Comp>;
+      using sort_rcvr =
+        stdexec::__t<sort_receiver<__cvref_id<CvrefSender>, stdexec::__id<Receiver>, Comp>>;
+      using inner_op_state = connect_result_t<CvrefSender, sort_rcvr>;
+
+      shared_state shared_state_;
+
+      inner_op_state inner_op_;
+
+      void start() & noexcept {
+        stdexec::start(inner_op_);
+      }
+
+      __t(static_thread_pool_& pool, Comp comp, CvrefSender&& sndr, Receiver rcvr)
+        : shared_state_(pool, static_cast<Receiver&&>(rcvr), static_cast<Comp&&>(comp))
+        , inner_op_{stdexec::connect(static_cast<CvrefSender&&>(sndr), sort_rcvr{shared_state_})} {
+      }
+    };
+
 #if STDEXEC_HAS_STD_RANGES()
     namespace schedule_all_ {
+      //! Returns the allocator of the receiver's environment, or an allocator that uses the
+      //! memory resource of the pool if the environment has none.
       template <class Rcvr>
-      auto get_allocator(const Rcvr& rcvr) {
+      auto get_allocator(const Rcvr& rcvr, static_thread_pool_& pool) {
         if constexpr (__callable<get_allocator_t, env_of_t<Rcvr>>) {
-          return get_allocator(get_env(rcvr));
+          return stdexec::get_allocator(stdexec::get_env(rcvr));
         } else {
-
-          return std::allocator<char>{};
+          return std::pmr::polymorphic_allocator<char>{&pool.get_memory_resource()};
         }
       }
 
       template <class Receiver>
-      using allocator_of_t = decltype(get_allocator(__declval<Receiver>()));
+      using allocator_of_t =
+        decltype(get_allocator(__declval<Receiver>(), __declval<static_thread_pool_&>()));
 
       template <class Range>
       struct operation_base {
@@ -1548,7 +2660,7 @@ namespace exec {
             : operation_base_with_receiver<
                 Range,
                 Receiver>{std::move(range), pool, static_cast<Receiver&&>(rcvr)}
-            , items_(std::ranges::size(this->range_), ItemAllocator(get_allocator(this->rcvr_))) {
+            , items_(std::ranges::size(this->range_), ItemAllocator(get_allocator(this->rcvr_, pool))) {
           }
 
           ~__t() {
@@ -1642,8 +2754,9 @@ namespace exec {
     static_thread_pool(
       std::uint32_t threadCount,
       bwos_params params = {},
-      numa_policy numa = get_numa_policy())
-      : _pool_::static_thread_pool_(threadCount, params, std::move(numa)) {
+      numa_policy numa = get_numa_policy(),
+      topology_params topology = {})
+      : _pool_::static_thread_pool_(threadCount, params, std::move(numa), std::move(topology)) {
     }
 
     // struct scheduler;
@@ -1666,6 +2779,15 @@ namespace exec {
 
     // bwos_params params() const;
     using _pool_::static_thread_pool_::params;
+
+    // numa_pool_resource& get_memory_resource() noexcept;
+    using _pool_::static_thread_pool_::get_memory_resource;
+
+    // std::pair<Shape, Shape> numa_node_share(Shape shape, int node) const noexcept;
+    using _pool_::static_thread_pool_::numa_node_share;
+
+    // std::pair<Shape, Shape> bulk_share(Shape shape, std::uint32_t threadIndex) const noexcept;
+    using _pool_::static_thread_pool_::bulk_share;
   };
 
 #if STDEXEC_HAS_STD_RANGES()
@@ -1682,4 +2804,21 @@ namespace exec {
   inline constexpr _pool_::schedule_all_t schedule_all{};
 #endif
 
+  namespace _pool_ {
+    struct numa_first_touch_t {
+      template <std::integral Shape, class Fun>
+      auto operator()(static_thread_pool::scheduler sched, Shape shape, Fun fun) const {
+        return stdexec::bulk_chunked(
+          stdexec::schedule(sched), stdexec::par, shape, static_cast<Fun&&>(fun));
+      }
+    };
+  } // namespace _pool_
+
+  //! Returns a sender that calls `fun(begin, end)` on each thread of the pool of `sched` for the
+  //! part of `[0, shape)` that the thread works on in bulk operations of that shape. Operating
+  //! systems place a page of memory on the NUMA node of the thread that first writes to it, so
+  //! initializing data this way places each part of it on the node whose threads process it
+  //! later. A thread of another node may take over a part if the pool is busy.
+  inline constexpr _pool_::numa_first_touch_t numa_first_touch{};
+
 } // namespace exec
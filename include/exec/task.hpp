@@ -29,6 +29,7 @@
 #include "at_coroutine_exit.hpp"
 #include "inline_scheduler.hpp"
 #include "scope.hpp"
+#include "variant_sender.hpp"
 
 STDEXEC_PRAGMA_PUSH()
 STDEXEC_PRAGMA_IGNORE_GNU("-Wundefined-inline")
@@ -37,13 +38,7 @@ namespace exec {
   namespace __task {
     using namespace stdexec;
 
-    // The required set_value_t() scheduler-sender completion signature is added in
-    // any_receiver_ref::any_sender::any_scheduler.
-    using __any_scheduler_completions =
-      completion_signatures<set_error_t(std::exception_ptr), set_stopped_t()>;
-
-    using __any_scheduler =
-      any_receiver_ref<__any_scheduler_completions>::any_sender<>::any_scheduler<>;
+    using __any_scheduler = __at_coro_exit::__any_scheduler;
 
     static_assert(scheduler<__any_scheduler>);
 
@@ -65,6 +60,36 @@ namespace exec {
         { get_env(t) } -> __scheduler_provider;
       };
 
+    //! Whether the sender reports a completion scheduler for the `_Tag` channel that compares
+    //! equal to `__sched`, or cannot complete through that channel at all.
+    template <class _Tag, class _Env, class _Sender, class _Scheduler>
+    auto __completes_on_for(const _Sender& __sndr, const _Scheduler& __sched) noexcept -> bool {
+      if constexpr (!__sends<_Tag, _Sender, _Env>) {
+        return true;
+      } else if constexpr (requires {
+                             {
+                               get_completion_scheduler<_Tag>(get_env(__sndr)) == __sched
+                             } -> std::convertible_to<bool>;
+                           }) {
+        return get_completion_scheduler<_Tag>(get_env(__sndr)) == __sched;
+      } else {
+        return false;
+      }
+    }
+
+    //! Whether all completions of the sender happen on `__sched`, so that a coroutine awaiting
+    //! it resumes on `__sched` without being rescheduled.
+    template <class _Env, class _Sender, class _Scheduler>
+    auto __completes_on(const _Sender& __sndr, const _Scheduler& __sched) noexcept -> bool {
+      return __task::__completes_on_for<set_value_t, _Env>(__sndr, __sched)
+          && __task::__completes_on_for<set_error_t, _Env>(__sndr, __sched)
+          && __task::__completes_on_for<set_stopped_t, _Env>(__sndr, __sched);
+    }
+
+    template <class _Sender, class _Scheduler>
+    using __continues_on_t =
+      decltype(continues_on(__declval<_Sender>(), __declval<const _Scheduler&>()));
+
     template <class _ParentPromise>
     constexpr auto __check_parent_promise_has_scheduler() noexcept -> bool {
       static_assert(
@@ -375,11 +400,27 @@ namespace exec {
         template <sender _Awaitable>
           requires __scheduler_provider<_Context>
         auto await_transform(_Awaitable&& __awaitable) noexcept -> decltype(auto) {
-          // TODO: If we have a complete-where-it-starts query then we can optimize
-          // this to avoid the reschedule
-          return as_awaitable(
-            continues_on(static_cast<_Awaitable&&>(__awaitable), get_scheduler(*__context_)),
-            *this);
+          using __scheduler_t = __decay_t<__call_result_t<get_scheduler_t, const _Context&>>;
+          using __env_t = env_of_t<__promise>;
+          if constexpr (requires {
+                          get_completion_scheduler<set_value_t>(stdexec::get_env(__awaitable));
+                        } && sender_in<_Awaitable, __env_t>) {
+            // If the awaited sender reports that it completes on the scheduler of this task,
+            // resuming the coroutine where the sender completes already keeps it on that
+            // scheduler, and the transition back onto it can be skipped.
+            using __sender_t =
+              variant_sender<_Awaitable, __continues_on_t<_Awaitable, __scheduler_t>>;
+            auto&& __sched = get_scheduler(*__context_);
+            if (__task::__completes_on<__env_t>(__awaitable, __sched)) {
+              return as_awaitable(__sender_t{static_cast<_Awaitable&&>(__awaitable)}, *this);
+            }
+            return as_awaitable(
+              __sender_t{continues_on(static_cast<_Awaitable&&>(__awaitable), __sched)}, *this);
+          } else {
+            return as_awaitable(
+              continues_on(static_cast<_Awaitable&&>(__awaitable), get_scheduler(*__context_)),
+              *this);
+          }
         }
 
         template <class _Scheduler>
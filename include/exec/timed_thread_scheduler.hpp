@@ -19,6 +19,8 @@
 
 #include "./timed_scheduler.hpp"
 #include "./__detail/intrusive_heap.hpp"
+#include "./__detail/__task_clock.hpp"
+#include "./__detail/__trace.hpp"
 
 #include "../stdexec/__detail/__intrusive_mpsc_queue.hpp"
 #include "../stdexec/__detail/__spin_loop_pause.hpp"
@@ -149,6 +151,12 @@ namespace exec {
         task_type* op = heap_.front();
         while (op && op->time_point_ <= now) {
           heap_.pop_front();
+          exec::__trace::__record(
+            trace_event::timer,
+            "timed_thread_context",
+            static_cast<std::uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(now - op->time_point_).count()));
+          exec::__task_clock::__note_task_begin();
           op->set_value_(op);
           op = heap_.front();
         }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/__detail/__basic_sender.hpp"
+#include "./__detail/__json.hpp"
+#include "./__detail/__trace.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <span>
+
+namespace exec {
+  namespace __trace {
+    using namespace stdexec;
+
+    inline std::atomic<std::uint64_t> __next_span_id{1};
+
+    struct __span {
+      const char* __name_;
+      std::uint64_t __id_{0};
+    };
+
+    struct __trace_impl : __sexpr_defaults {
+      static constexpr auto get_completion_signatures = //
+        []<class _Sender, class... _Env>(_Sender&&, _Env&&...) noexcept {
+          return __completion_signatures_of_t<__child_of<_Sender>, _Env...>{};
+        };
+
+      static constexpr auto get_state = //
+        []<class _Sender>(_Sender&& __sndr, __ignore) noexcept -> __span {
+        return __span{__sndr.apply(static_cast<_Sender&&>(__sndr), __detail::__get_data())};
+      };
+
+      static constexpr auto start = //
+        []<class _Receiver, class _ChildOp>(__span& __s, _Receiver&, _ChildOp& __child) noexcept
+        -> void {
+        if (__enabled.load(std::memory_order_relaxed)) {
+          __s.__id_ = __next_span_id.fetch_add(1, std::memory_order_relaxed);
+          __trace::__record_slow(trace_event::span_begin, __s.__name_, __s.__id_);
+        }
+        stdexec::start(__child);
+      };
+
+      static constexpr auto complete = //
+        []<class _Receiver, class _Tag, class... _Args>(
+          __ignore,
+          __span& __s,
+          _Receiver& __rcvr,
+          _Tag,
+          _Args&&... __args) noexcept -> void {
+        if (__s.__id_ != 0) {
+          // The span is closed even if tracing was stopped in the meantime.
+          __trace::__record_slow(trace_event::span_end, __s.__name_, __s.__id_);
+        }
+        _Tag()(static_cast<_Receiver&&>(__rcvr), static_cast<_Args&&>(__args)...);
+      };
+    };
+
+    struct trace_t {
+      template <sender _Sender>
+      auto operator()(const char* __name, _Sender&& __sndr) const {
+        auto __domain = __get_early_domain(__sndr);
+        return stdexec::transform_sender(
+          __domain, __make_sexpr<trace_t>(__name, static_cast<_Sender&&>(__sndr)));
+      }
+
+      template <sender _Sender>
+      auto operator()(_Sender&& __sndr, const char* __name) const {
+        return (*this)(__name, static_cast<_Sender&&>(__sndr));
+      }
+
+      STDEXEC_ATTRIBUTE((always_inline))
+      auto operator()(const char* __name) const noexcept -> __binder_back<trace_t, const char*> {
+        return {{__name}, {}, {}};
+      }
+    };
+
+    inline auto __event_name(trace_event __event) noexcept -> const char* {
+      switch (__event) {
+      case trace_event::enqueue:
+        return "enqueue";
+      case trace_event::dequeue:
+        return "dequeue";
+      case trace_event::steal:
+        return "steal";
+      case trace_event::sleep:
+      case trace_event::wake:
+        return "sleep";
+      case trace_event::timer:
+        return "timer";
+      case trace_event::submit:
+        return "submit";
+      case trace_event::complete:
+        return "complete";
+      case trace_event::span_begin:
+      case trace_event::span_end:
+        return "span";
+      }
+      return "unknown";
+    }
+  } // namespace __trace
+
+  using __trace::trace_t;
+
+  //! `trace(name, sndr)` records a span from the start of `sndr` to its completion while tracing
+  //! is started. `name` must have static storage duration. Spans can end on another thread than
+  //! the one they began on, so they are exported as asynchronous events.
+  inline constexpr trace_t trace{};
+
+  //! Writes events in the JSON format of the Chrome trace viewer, which Perfetto reads as well.
+  //! Events of schedulers are named after what happened and categorized by the scheduler that
+  //! recorded them. Sleeping threads are shown as durations, and traced senders as async spans.
+  inline void write_chrome_trace(std::ostream& out, std::span<const trace_record> records) {
+    const std::uint64_t origin = records.empty() ? 0 : records.front().time_ns;
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed;
+    out.precision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    const char* separator = "\n";
+    for (const trace_record& record: records) {
+      const bool is_span =
+        record.event == trace_event::span_begin || record.event == trace_event::span_end;
+      out << separator << "{\"name\":";
+      const char* name = is_span ? record.name : __trace::__event_name(record.event);
+      __json::__write_string(out, name);
+      out << ",\"cat\":";
+      __json::__write_string(out, is_span ? "sender" : record.name);
+      switch (record.event) {
+      case trace_event::sleep:
+        out << ",\"ph\":\"B\"";
+        break;
+      case trace_event::wake:
+        out << ",\"ph\":\"E\"";
+        break;
+      case trace_event::span_begin:
+        out << ",\"ph\":\"b\",\"id\":" << record.arg;
+        break;
+      case trace_event::span_end:
+        out << ",\"ph\":\"e\",\"id\":" << record.arg;
+        break;
+      default:
+        out << ",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"arg\":" << record.arg << '}';
+        break;
+      }
+      out << ",\"ts\":" << static_cast<double>(record.time_ns - origin) / 1000.0
+          << ",\"pid\":1,\"tid\":" << record.thread << '}';
+      separator = ",\n";
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+  }
+} // namespace exec
+
+namespace stdexec {
+  template <>
+  struct __sexpr_impl<exec::__trace::trace_t> : exec::__trace::__trace_impl { };
+} // namespace stdexec
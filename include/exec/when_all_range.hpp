@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "../stdexec/stop_token.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace exec {
+  namespace __when_all_range {
+    using namespace stdexec;
+
+    enum __state_t {
+      __started,
+      __error,
+      __stopped
+    };
+
+    struct __on_stop_request {
+      inplace_stop_source& __stop_source_;
+
+      void operator()() noexcept {
+        __stop_source_.request_stop();
+      }
+    };
+
+    template <class _BaseEnv>
+    using __env_t = __env::__join_t<prop<get_stop_token_t, inplace_stop_token>, _BaseEnv>;
+
+    //! The decayed type of the single value that the senders in the range send, or `void`.
+    template <class _CvrefSender, class... _Env>
+    using __value_of_t = __value_types_t<
+      __completion_signatures_of_t<_CvrefSender, __env_t<_Env>...>,
+      __mtransform<__q<__decay_t>, __msingle_or<void>>,
+      __msingle_or<void>>;
+
+    //! Without a reduction, the values are collected into a vector in the order of the range.
+    struct __no_fold {
+      template <class _Value>
+      struct __result {
+        using __t = std::vector<_Value>;
+      };
+
+      template <class _Value>
+      using __result_t = stdexec::__t<__result<_Value>>;
+    };
+
+    template <>
+    struct __no_fold::__result<void> {
+      using __t = void;
+    };
+
+    //! With a reduction, the values are folded into `__init_` in the order of the range.
+    template <class _Init, class _Fun>
+    struct __fold {
+      template <class _Value>
+      using __result_t = _Init;
+
+      _Init __init_;
+      _Fun __fun_;
+    };
+
+    template <class _Result>
+    struct __set_value_sig {
+      using __t = set_value_t(_Result);
+    };
+
+    template <>
+    struct __set_value_sig<void> {
+      using __t = set_value_t();
+    };
+
+    template <class _Result>
+    using __set_value_sig_t = stdexec::__t<__set_value_sig<_Result>>;
+
+    template <class...>
+    using __drop_values_t = completion_signatures<>;
+
+    template <class _Error>
+    using __decayed_error_t = completion_signatures<set_error_t(__decay_t<_Error>)>;
+
+    // The result can fail to allocate, so set_error(exception_ptr) is always there. The errors
+    // of the senders are forwarded decayed, as they are stored until all senders complete.
+    template <class _Fold, class _CvrefSender, class... _Env>
+    using __completions_t = //
+      __concat_completion_signatures<
+        completion_signatures<
+          __set_value_sig_t<
+            typename _Fold::template __result_t<__value_of_t<_CvrefSender, _Env...>>>,
+          set_error_t(std::exception_ptr),
+          set_stopped_t()>,
+        transform_completion_signatures<
+          __completion_signatures_of_t<_CvrefSender, __env_t<_Env>...>,
+          completion_signatures<>,
+          __drop_values_t,
+          __decayed_error_t>>;
+
+    template <class _CvrefSender, class _Env>
+    using __errors_variant_t = __error_types_of_t<
+      _CvrefSender,
+      __env_t<_Env>,
+      __mbind_front_q<__uniqued_variant_for, std::exception_ptr>>;
+
+    //! Whether a sender of the range can complete with an error or a stopped signal, either of
+    //! which asks the other senders to stop.
+    template <class _CvrefSender, class _Env>
+    inline constexpr bool __children_may_stop =
+      __sends<set_error_t, _CvrefSender, __env_t<_Env>>
+      || __sends<set_stopped_t, _CvrefSender, __env_t<_Env>>
+      || !__v<__when_all::__nothrow_decay_copyable_results<_CvrefSender, __env_t<_Env>>>;
+
+    //! Where a sender stores its value until all senders have completed.
+    template <class _Value>
+    using __slot_t = __if_c<same_as<_Value, void>, __ignore, std::optional<_Value>>;
+
+    template <class _Receiver, class _Value, class _ErrorsVariant>
+    struct __op_base : __immovable {
+      using __on_stop =
+        stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>&>, __on_stop_request>;
+
+      __op_base(
+        _Receiver&& __rcvr,
+        std::size_t __size,
+        bool __stop_possible,
+        void (*__set_values)(__op_base*) noexcept)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+        , __size_{__size}
+        , __count_{__size}
+        , __stop_possible_{__stop_possible}
+        , __set_values_{__set_values} {
+      }
+
+      template <class... _Args>
+      void __set_value(__slot_t<_Value>* __slot, _Args&&... __args) noexcept {
+        // Only bother recording the value if no sender has failed.
+        if constexpr (sizeof...(_Args) != 0) {
+          if (__state_.load(std::memory_order_relaxed) == __started) {
+            if constexpr ((__nothrow_decay_copyable<_Args> && ...)) {
+              __slot->emplace(static_cast<_Args&&>(__args)...);
+            } else {
+              try {
+                __slot->emplace(static_cast<_Args&&>(__args)...);
+              } catch (...) {
+                __set_error(std::current_exception());
+              }
+            }
+          }
+        }
+        __arrive();
+      }
+
+      template <class _Error>
+      void __set_error(_Error&& __err) noexcept {
+        switch (__state_.exchange(__error, std::memory_order_relaxed)) {
+        case __started:
+          // We are the first sender to fail. Stop the others.
+          __stop_source_.request_stop();
+          [[fallthrough]];
+        case __stopped:
+          // Errors trump stopped signals. Any later error is ignored.
+          if constexpr (__nothrow_decay_copyable<_Error>) {
+            __errors_.template emplace<__decay_t<_Error>>(static_cast<_Error&&>(__err));
+          } else {
+            try {
+              __errors_.template emplace<__decay_t<_Error>>(static_cast<_Error&&>(__err));
+            } catch (...) {
+              __errors_.template emplace<std::exception_ptr>(std::current_exception());
+            }
+          }
+          break;
+        case __error:;
+        }
+      }
+
+      void __set_stopped() noexcept {
+        __state_t __expected = __started;
+        if (__state_.compare_exchange_strong(
+              __expected, __stopped, std::memory_order_relaxed, std::memory_order_relaxed)) {
+          __stop_source_.request_stop();
+        }
+      }
+
+      void __arrive() noexcept {
+        // make the stored values and errors visible when __count_ goes from one to zero
+        if (__count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          __complete();
+        }
+      }
+
+      void __complete() noexcept {
+        __on_stop_.reset();
+        switch (__state_.load(std::memory_order_relaxed)) {
+        case __started:
+          __set_values_(this);
+          break;
+        case __error:
+          STDEXEC_ASSERT(!__errors_.is_valueless());
+          __errors_.visit(
+            __mk_completion_fn(set_error, __rcvr_), static_cast<_ErrorsVariant&&>(__errors_));
+          break;
+        case __stopped:
+          stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          break;
+        }
+      }
+
+      _Receiver __rcvr_;
+      std::size_t __size_;
+      std::atomic<std::size_t> __count_;
+      // Whether __stop_source_ can be asked to stop. If not, the senders are given a token
+      // without a source, so that they do not register stop callbacks with it.
+      bool __stop_possible_;
+      std::atomic<__state_t> __state_{__started};
+      inplace_stop_source __stop_source_{};
+      std::optional<__on_stop> __on_stop_{};
+      _ErrorsVariant __errors_{};
+      void (*__set_values_)(__op_base*) noexcept;
+    };
+
+    template <class _OpBase, class _Value>
+    struct __receiver {
+      class __t {
+       public:
+        using receiver_concept = stdexec::receiver_t;
+        using __id = __receiver;
+
+        explicit __t(_OpBase* __op, __slot_t<_Value>* __slot) noexcept
+          : __op_{__op}
+          , __slot_{__slot} {
+        }
+
+        auto get_env() const noexcept -> __env_t<env_of_t<decltype(_OpBase::__rcvr_)>> {
+          auto __token = prop{
+            get_stop_token,
+            __op_->__stop_possible_ ? __op_->__stop_source_.get_token() : inplace_stop_token{}};
+          return __env::__join(std::move(__token), stdexec::get_env(__op_->__rcvr_));
+        }
+
+        template <class... _Args>
+        void set_value(_Args&&... __args) noexcept {
+          __op_->__set_value(__slot_, static_cast<_Args&&>(__args)...);
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __err) noexcept {
+          __op_->__set_error(static_cast<_Error&&>(__err));
+          __op_->__arrive();
+        }
+
+        void set_stopped() noexcept {
+          __op_->__set_stopped();
+          __op_->__arrive();
+        }
+
+       private:
+        _OpBase* __op_;
+        __slot_t<_Value>* __slot_;
+      };
+    };
+
+    //! The operation of one sender of the range, next to the slot for its value.
+    template <class _CvrefSender, class _Receiver, class _Value>
+    struct __child : __immovable {
+      __child(_CvrefSender&& __sndr, _Receiver __rcvr)
+        : __op_{stdexec::connect(static_cast<_CvrefSender&&>(__sndr), std::move(__rcvr))} {
+      }
+
+      STDEXEC_ATTRIBUTE((no_unique_address))
+      __slot_t<_Value> __value_{};
+      connect_result_t<_CvrefSender, _Receiver> __op_;
+    };
+
+    template <class _CvrefSenderId, class _ReceiverId, class _Fold>
+    struct __operation {
+      using _CvrefSender = __cvref_t<_CvrefSenderId>;
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using _Env = env_of_t<_Receiver>;
+      using __value_t = __value_of_t<_CvrefSender, _Env>;
+      using __op_base_t = __op_base<_Receiver, __value_t, __errors_variant_t<_CvrefSender, _Env>>;
+      using __receiver_t = stdexec::__t<__receiver<__op_base_t, __value_t>>;
+      using __child_t = __child<_CvrefSender, __receiver_t, __value_t>;
+
+      //! The operations of the senders are allocated in one array, with the allocator of the
+      //! environment of the receiver if it has one.
+      static constexpr auto __get_allocator(const _Env& __env) noexcept {
+        if constexpr (__callable<get_allocator_t, const _Env&>) {
+          using _Alloc = __decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+          using _ChildAlloc =
+            typename std::allocator_traits<_Alloc>::template rebind_alloc<__child_t>;
+          return _ChildAlloc{stdexec::get_allocator(__env)};
+        } else {
+          return std::allocator<__child_t>{};
+        }
+      }
+
+      using __alloc_t = decltype(__get_allocator(__declval<const _Env&>()));
+      using __alloc_traits = std::allocator_traits<__alloc_t>;
+
+      class __t : __op_base_t {
+       public:
+        using __id = __operation;
+
+        template <class _CvrefRange>
+        __t(_CvrefRange&& __range, _Fold __fold, _Receiver __rcvr)
+          : __op_base_t{
+              static_cast<_Receiver&&>(__rcvr),
+              static_cast<std::size_t>(std::ranges::distance(__range)),
+              // Stop can only be requested by a failing sender or through the receiver's token.
+              __children_may_stop<_CvrefSender, _Env>
+                || get_stop_token(stdexec::get_env(__rcvr)).stop_possible(),
+              &__set_values}
+          , __fold_{static_cast<_Fold&&>(__fold)} {
+          if (this->__size_ == 0) {
+            return;
+          }
+          __alloc_t __alloc = __get_allocator(stdexec::get_env(this->__rcvr_));
+          __children_ = __alloc_traits::allocate(__alloc, this->__size_);
+          std::size_t __n_connected = 0;
+          __scope_guard __guard{[&]() noexcept {
+            __destroy(__alloc, __n_connected);
+          }};
+          for (auto&& __sndr: __range) {
+            __child_t* __child = __children_ + __n_connected;
+            __alloc_traits::construct(
+              __alloc,
+              __child,
+              static_cast<_CvrefSender&&>(__sndr),
+              __receiver_t{this, std::addressof(__child->__value_)});
+            ++__n_connected;
+          }
+          __guard.__dismiss();
+        }
+
+        ~__t() {
+          if (__children_) {
+            __alloc_t __alloc = __get_allocator(stdexec::get_env(this->__rcvr_));
+            __destroy(__alloc, this->__size_);
+          }
+        }
+
+        void start() & noexcept {
+          this->__on_stop_.emplace(
+            get_stop_token(stdexec::get_env(this->__rcvr_)),
+            __on_stop_request{this->__stop_source_});
+          if (this->__stop_source_.stop_requested()) {
+            // Stop has already been requested. Don't bother starting the senders.
+            this->__on_stop_.reset();
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__rcvr_));
+          } else if (this->__size_ == 0) {
+            this->__complete();
+          } else {
+            // The last sender to complete may complete and destroy this operation, so we must not
+            // access any members after starting it.
+            __child_t* __first = __children_;
+            __child_t* __last = __first + this->__size_;
+            for (; __first != __last; ++__first) {
+              stdexec::start(__first->__op_);
+            }
+          }
+        }
+
+       private:
+        void __destroy(__alloc_t& __alloc, std::size_t __n_constructed) noexcept {
+          for (std::size_t __i = __n_constructed; __i != 0; --__i) {
+            __alloc_traits::destroy(__alloc, __children_ + (__i - 1));
+          }
+          __alloc_traits::deallocate(__alloc, __children_, this->__size_);
+        }
+
+        static void __set_values(__op_base_t* __base) noexcept {
+          auto* __self = static_cast<__t*>(__base);
+          _Receiver& __rcvr = __self->__rcvr_;
+          if constexpr (same_as<__value_t, void>) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr));
+          } else {
+            __child_t* __first = __self->__children_;
+            __child_t* __last = __first + __self->__size_;
+            try {
+              if constexpr (same_as<_Fold, __no_fold>) {
+                std::vector<__value_t> __values;
+                __values.reserve(__self->__size_);
+                for (; __first != __last; ++__first) {
+                  __values.push_back(std::move(*__first->__value_));
+                }
+                stdexec::set_value(static_cast<_Receiver&&>(__rcvr), std::move(__values));
+              } else {
+                auto& __fold = __self->__fold_;
+                for (; __first != __last; ++__first) {
+                  __fold.__init_ = __fold.__fun_(
+                    std::move(__fold.__init_), std::move(*__first->__value_));
+                }
+                stdexec::set_value(static_cast<_Receiver&&>(__rcvr), std::move(__fold.__init_));
+              }
+            } catch (...) {
+              stdexec::set_error(static_cast<_Receiver&&>(__rcvr), std::current_exception());
+            }
+          }
+        }
+
+        STDEXEC_ATTRIBUTE((no_unique_address))
+        _Fold __fold_;
+        __child_t* __children_{nullptr};
+      };
+    };
+
+    template <class _RangeId, class _Fold>
+    struct __sender {
+      using _Range = stdexec::__t<_RangeId>;
+      using _Sender = std::ranges::range_value_t<_Range>;
+
+      template <class _Self, class _Receiver>
+      using __op_t = stdexec::__t<
+        __operation<__cvref_id<__copy_cvref_t<_Self, _Sender>>, __id<_Receiver>, _Fold>>;
+
+      class __t {
+       public:
+        using __id = __sender;
+        using sender_concept = stdexec::sender_t;
+
+        template <class _CvrefRange>
+        __t(_CvrefRange&& __range, _Fold __fold)
+          : __range_{static_cast<_CvrefRange&&>(__range)}
+          , __fold_{static_cast<_Fold&&>(__fold)} {
+        }
+
+        template <__decays_to<__t> _Self, receiver _Receiver>
+        static auto connect(_Self&& __self, _Receiver __rcvr) -> __op_t<_Self, _Receiver> {
+          return __op_t<_Self, _Receiver>{
+            static_cast<_Self&&>(__self).__range_,
+            static_cast<_Self&&>(__self).__fold_,
+            static_cast<_Receiver&&>(__rcvr)};
+        }
+
+        template <__decays_to<__t> _Self, class... _Env>
+        static auto get_completion_signatures(_Self&&, _Env&&...) noexcept
+          -> __completions_t<_Fold, __copy_cvref_t<_Self, _Sender>, _Env...> {
+          return {};
+        }
+
+       private:
+        _Range __range_;
+        STDEXEC_ATTRIBUTE((no_unique_address))
+        _Fold __fold_;
+      };
+    };
+
+    template <class _Range>
+    concept __sender_range = //
+      std::ranges::forward_range<_Range> && sender<std::ranges::range_value_t<_Range>>
+      && __decay_copyable<_Range>;
+
+    struct when_all_range_t {
+      template <class _Range, class _Fold>
+      using __sender_t = stdexec::__t<__sender<__id<__decay_t<_Range>>, _Fold>>;
+
+      template <__sender_range _Range>
+      auto operator()(_Range&& __range) const -> __sender_t<_Range, __no_fold> {
+        return __sender_t<_Range, __no_fold>{static_cast<_Range&&>(__range), __no_fold{}};
+      }
+
+      template <__sender_range _Range, __movable_value _Init, __movable_value _Fun>
+      auto operator()(_Range&& __range, _Init __init, _Fun __fun) const
+        -> __sender_t<_Range, __fold<_Init, _Fun>> {
+        return __sender_t<_Range, __fold<_Init, _Fun>>{
+          static_cast<_Range&&>(__range),
+          __fold<_Init, _Fun>{static_cast<_Init&&>(__init), static_cast<_Fun&&>(__fun)}};
+      }
+    };
+  } // namespace __when_all_range
+
+  using __when_all_range::when_all_range_t;
+
+  //! `when_all_range(sndrs)` starts all senders of the forward range `sndrs`, which can have any
+  //! size, and completes with a `std::vector` of their values in the order of the range, or with
+  //! no value if they send none. `when_all_range(sndrs, init, fun)` instead completes with the
+  //! result of folding the values into `init` with `fun`, also in the order of the range. The
+  //! operations of the senders are allocated in a single array, with the allocator of the
+  //! receiver's environment if it has one. As with `when_all`, the first error or stopped signal
+  //! stops the remaining senders and is forwarded once all of them have completed.
+  inline constexpr when_all_range_t when_all_range{};
+} // namespace exec
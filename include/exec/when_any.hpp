@@ -19,7 +19,12 @@
 #include "../stdexec/execution.hpp"
 #include "../stdexec/stop_token.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <exception>
+#include <optional>
+#include <utility>
 
 STDEXEC_PRAGMA_PUSH()
 STDEXEC_PRAGMA_IGNORE_GNU("-Wmissing-braces")
@@ -91,7 +96,25 @@ namespace exec {
       };
     }
 
-    template <class _Receiver, class _ResultVariant>
+    //! Stores a completion in `__result`, or the exception that storing it throws.
+    template <class _ResultVariant, class _Tag, class... _Args>
+    void __emplace_result(_ResultVariant& __result, _Tag, _Args&&... __args) noexcept {
+      using __result_t = __decayed_tuple<_Tag, _Args...>;
+      if constexpr ((__nothrow_decay_copyable<_Args> && ...)) {
+        __result.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
+      } else {
+        try {
+          __result.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
+        } catch (...) {
+          using __error_t = __tuple_for<set_error_t, std::exception_ptr>;
+          __result.template emplace<__error_t>(set_error_t{}, std::current_exception());
+        }
+      }
+    }
+
+    //! With `_FirstValue`, the first value completion wins, and errors and stopped signals are
+    //! only forwarded if no sender completes with a value. Otherwise the first completion wins.
+    template <class _Receiver, class _ResultVariant, bool _FirstValue>
     struct __op_base : __immovable {
       __op_base(_Receiver&& __rcvr, std::size_t __n_senders)
         : __count_{__n_senders}
@@ -109,28 +132,29 @@ namespace exec {
       // If this hits zero, we forward any result to the receiver
       std::atomic<std::size_t> __count_{};
 
+      // With _FirstValue, the first error or stopped signal is kept here in case no value comes
+      std::atomic<bool> __fallback_emplaced_{false};
+
       _Receiver __rcvr_;
       _ResultVariant __result_{};
+      STDEXEC_ATTRIBUTE((no_unique_address))
+      __if_c<_FirstValue, _ResultVariant, __ignore> __fallback_{};
 
       template <class _Tag, class... _Args>
       void notify(_Tag, _Args&&... __args) noexcept {
-        using __result_t = __decayed_tuple<_Tag, _Args...>;
         bool __expect = false;
-        if (__emplaced_.compare_exchange_strong(
-              __expect, true, std::memory_order_relaxed, std::memory_order_relaxed)) {
-          // This emplacement can happen only once
-          if constexpr ((__nothrow_decay_copyable<_Args> && ...)) {
-            __result_.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
-          } else {
-            try {
-              __result_.template emplace<__result_t>(_Tag{}, static_cast<_Args&&>(__args)...);
-            } catch (...) {
-              using __error_t = __tuple_for<set_error_t, std::exception_ptr>;
-              __result_.template emplace<__error_t>(set_error_t{}, std::current_exception());
-            }
+        if constexpr (_FirstValue && !same_as<_Tag, set_value_t>) {
+          if (__fallback_emplaced_.compare_exchange_strong(
+                __expect, true, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            __when_any::__emplace_result(__fallback_, _Tag{}, static_cast<_Args&&>(__args)...);
           }
-          // stop pending operations
+        } else if (__emplaced_.compare_exchange_strong(
+                     __expect, true, std::memory_order_relaxed, std::memory_order_relaxed)) {
+          // Stop the pending operations before storing the result. They cannot complete the
+          // operation before then, because our own completion keeps __count_ above zero.
           __stop_source_.request_stop();
+          // This emplacement can happen only once
+          __when_any::__emplace_result(__result_, _Tag{}, static_cast<_Args&&>(__args)...);
         }
         // make __result_ emplacement visible when __count_ goes from one to zero
         // This relies on the fact that each sender will call notify() at most once
@@ -141,6 +165,15 @@ namespace exec {
             stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
             return;
           }
+          if constexpr (_FirstValue) {
+            if (!__emplaced_.load(std::memory_order_relaxed)) {
+              STDEXEC_ASSERT(!__fallback_.is_valueless());
+              __fallback_.visit(
+                __when_any::__make_visitor_fn(__rcvr_),
+                static_cast<_ResultVariant&&>(__fallback_));
+              return;
+            }
+          }
           STDEXEC_ASSERT(!__result_.is_valueless());
           __result_.visit(
             __when_any::__make_visitor_fn(__rcvr_), static_cast<_ResultVariant&&>(__result_));
@@ -148,14 +181,14 @@ namespace exec {
       }
     };
 
-    template <class _Receiver, class _ResultVariant>
+    template <class _Receiver, class _ResultVariant, bool _FirstValue>
     struct __receiver {
       class __t {
        public:
         using receiver_concept = stdexec::receiver_t;
         using __id = __receiver;
 
-        explicit __t(__op_base<_Receiver, _ResultVariant>* __op) noexcept
+        explicit __t(__op_base<_Receiver, _ResultVariant, _FirstValue>* __op) noexcept
           : __op_{__op} {
         }
 
@@ -179,17 +212,17 @@ namespace exec {
         }
 
        private:
-        __op_base<_Receiver, _ResultVariant>* __op_;
+        __op_base<_Receiver, _ResultVariant, _FirstValue>* __op_;
       };
     };
 
-    template <class _ReceiverId, class... _CvrefSenderIds>
+    template <bool _FirstValue, class _ReceiverId, class... _CvrefSenderIds>
     struct __op {
       using _Receiver = stdexec::__t<_ReceiverId>;
 
       using __result_t = __result_type_t<env_of_t<_Receiver>, __cvref_t<_CvrefSenderIds>...>;
-      using __receiver_t = stdexec::__t<__receiver<_Receiver, __result_t>>;
-      using __op_base_t = __op_base<_Receiver, __result_t>;
+      using __receiver_t = stdexec::__t<__receiver<_Receiver, __result_t, _FirstValue>>;
+      using __op_base_t = __op_base<_Receiver, __result_t, _FirstValue>;
 
       static constexpr bool __nothrow_construct = //
         __nothrow_move_constructible<_Receiver>
@@ -226,17 +259,18 @@ namespace exec {
       };
     };
 
-    template <class... _SenderIds>
+    template <bool _FirstValue, class... _SenderIds>
     struct __sender {
       template <class _Self, class _Env>
       using __result_t = __result_type_t<_Env, __copy_cvref_t<_Self, stdexec::__t<_SenderIds>>...>;
 
       template <class _Self, class _Receiver>
       using __receiver_t =
-        stdexec::__t<__receiver<_Receiver, __result_t<_Self, env_of_t<_Receiver>>>>;
+        stdexec::__t<__receiver<_Receiver, __result_t<_Self, env_of_t<_Receiver>>, _FirstValue>>;
 
       template <class _Self, class _Receiver>
-      using __op_t = stdexec::__t<__op<__id<_Receiver>, __copy_cvref_t<_Self, _SenderIds>...>>;
+      using __op_t =
+        stdexec::__t<__op<_FirstValue, __id<_Receiver>, __copy_cvref_t<_Self, _SenderIds>...>>;
 
       template <class _Self, class... _Env>
       using __completions_t = //
@@ -277,9 +311,10 @@ namespace exec {
       };
     };
 
+    template <bool _FirstValue>
     struct __when_any_t {
       template <class... _Senders>
-      using __sender_t = __t<__sender<__id<__decay_t<_Senders>>...>>;
+      using __sender_t = __t<__sender<_FirstValue, __id<__decay_t<_Senders>>...>>;
 
       template <sender... _Senders>
         requires(sizeof...(_Senders) > 0 && sender<__sender_t<_Senders...>>)
@@ -289,10 +324,301 @@ namespace exec {
       }
     };
 
-    inline constexpr __when_any_t when_any{};
+    ////////////////////////////////////////////////////////////////////////////
+    // when_any_n
+    template <class _CvrefSender, class... _Env>
+    using __n_value_of_t = __decay_t<__single_sender_value_t<_CvrefSender, _Env...>>;
+
+    template <class...>
+    using __drop_values_t = completion_signatures<>;
+
+    // when_any_n sends an array of the first _Count values, and forwards the errors and stopped
+    // signals of the senders as they are.
+    template <std::size_t _Count, class... _Env>
+    struct __n_completions_fn {
+      template <class... _CvrefSenders>
+      using __f = __concat_completion_signatures<
+        completion_signatures<
+          set_value_t(std::array<__n_value_of_t<__mfront<_CvrefSenders...>, _Env...>, _Count>),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()>,
+        transform_completion_signatures<
+          __completion_signatures_of_t<_CvrefSenders, _Env...>,
+          completion_signatures<>,
+          __drop_values_t>...>;
+    };
+
+    template <
+      std::size_t _Count,
+      std::size_t _NSenders,
+      class _Receiver,
+      class _Value,
+      class _ResultVariant>
+    struct __n_op_base : __immovable {
+      explicit __n_op_base(_Receiver&& __rcvr)
+        : __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+      }
+
+      using __on_stop =
+        stop_callback_for_t<stop_token_of_t<env_of_t<_Receiver>&>, __on_stop_requested>;
+
+      inplace_stop_source __stop_source_{};
+      std::optional<__on_stop> __on_stop_{};
+
+      // How many values, and how many errors or stopped signals, have arrived
+      std::atomic<std::size_t> __n_values_{0};
+      std::atomic<std::size_t> __n_failures_{0};
+      // If this hits true, we have stored the first error or stopped signal
+      std::atomic<bool> __emplaced_{false};
+      // If this hits zero, we forward the result to the receiver
+      std::atomic<std::size_t> __count_{_NSenders};
+
+      _Receiver __rcvr_;
+      // The value of each sender, and the indices of the senders whose values arrived first
+      std::optional<_Value> __values_[_NSenders]{};
+      std::size_t __order_[_Count]{};
+      _ResultVariant __result_{};
+
+      template <class _Arg>
+      void __set_value(std::size_t __index, _Arg&& __arg) noexcept {
+        if constexpr (__nothrow_constructible_from<_Value, _Arg>) {
+          __values_[__index].emplace(static_cast<_Arg&&>(__arg));
+        } else {
+          try {
+            __values_[__index].emplace(static_cast<_Arg&&>(__arg));
+          } catch (...) {
+            __set_failure(set_error_t{}, std::current_exception());
+            return;
+          }
+        }
+        const std::size_t __rank = __n_values_.fetch_add(1, std::memory_order_relaxed);
+        if (__rank < _Count) {
+          __order_[__rank] = __index;
+          if (__rank + 1 == _Count) {
+            // We have all the values we need. Stop the pending operations.
+            __stop_source_.request_stop();
+          }
+        }
+        __arrive();
+      }
+
+      template <class _Tag, class... _Args>
+      void __set_failure(_Tag, _Args&&... __args) noexcept {
+        bool __expect = false;
+        if (__emplaced_.compare_exchange_strong(
+              __expect, true, std::memory_order_relaxed, std::memory_order_relaxed)) {
+          __when_any::__emplace_result(__result_, _Tag{}, static_cast<_Args&&>(__args)...);
+        }
+        if (__n_failures_.fetch_add(1, std::memory_order_relaxed) == _NSenders - _Count) {
+          // Fewer than _Count values can arrive now. Stop the pending operations.
+          __stop_source_.request_stop();
+        }
+        __arrive();
+      }
+
+      void __arrive() noexcept {
+        // make the stored results visible when __count_ goes from one to zero
+        if (__count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          __on_stop_.reset();
+          auto stop_token = get_stop_token(get_env(__rcvr_));
+          if (stop_token.stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          } else if (__n_values_.load(std::memory_order_relaxed) >= _Count) {
+            __complete_with_values(std::make_index_sequence<_Count>{});
+          } else {
+            STDEXEC_ASSERT(!__result_.is_valueless());
+            __result_.visit(
+              __when_any::__make_visitor_fn(__rcvr_), static_cast<_ResultVariant&&>(__result_));
+          }
+        }
+      }
+
+      template <std::size_t... _Is>
+      void __complete_with_values(std::index_sequence<_Is...>) noexcept {
+        try {
+          stdexec::set_value(
+            static_cast<_Receiver&&>(__rcvr_),
+            std::array<_Value, _Count>{std::move(*__values_[__order_[_Is]])...});
+        } catch (...) {
+          stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+        }
+      }
+    };
+
+    template <class _Receiver, class _OpBase>
+    struct __n_receiver {
+      class __t {
+       public:
+        using receiver_concept = stdexec::receiver_t;
+        using __id = __n_receiver;
+
+        explicit __t(_OpBase* __op, std::size_t __index) noexcept
+          : __op_{__op}
+          , __index_{__index} {
+        }
+
+        auto get_env() const noexcept -> __env_t<env_of_t<_Receiver>> {
+          auto __token = prop{get_stop_token, __op_->__stop_source_.get_token()};
+          return __env::__join(std::move(__token), stdexec::get_env(__op_->__rcvr_));
+        }
+
+        template <class _Arg>
+        void set_value(_Arg&& __arg) noexcept {
+          __op_->__set_value(__index_, static_cast<_Arg&&>(__arg));
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __err) noexcept {
+          __op_->__set_failure(set_error_t(), static_cast<_Error&&>(__err));
+        }
+
+        void set_stopped() noexcept {
+          __op_->__set_failure(set_stopped_t());
+        }
+
+       private:
+        _OpBase* __op_;
+        std::size_t __index_;
+      };
+    };
+
+    template <std::size_t _Count, class _ReceiverId, class... _CvrefSenderIds>
+    struct __n_op {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using _Env = env_of_t<_Receiver>;
+
+      using __value_t = __n_value_of_t<__cvref_t<__mfront<_CvrefSenderIds...>>, _Env>;
+      static_assert(
+        (same_as<__n_value_of_t<__cvref_t<_CvrefSenderIds>, _Env>, __value_t> && ...),
+        "exec::when_any_n requires all senders to send a single value of the same type");
+
+      using __result_t = //
+        __for_each_completion_signature<
+          __minvoke<__n_completions_fn<_Count, _Env>, __cvref_t<_CvrefSenderIds>...>,
+          __decayed_tuple,
+          __uniqued_variant_for>;
+      using __op_base_t =
+        __n_op_base<_Count, sizeof...(_CvrefSenderIds), _Receiver, __value_t, __result_t>;
+      using __receiver_t = stdexec::__t<__n_receiver<_Receiver, __op_base_t>>;
+
+      static constexpr bool __nothrow_construct = //
+        __nothrow_move_constructible<_Receiver>
+        && (__nothrow_connectable<__cvref_t<_CvrefSenderIds>, __receiver_t> && ...);
+
+      class __t : __op_base_t {
+        using __opstate_tuple =
+          __tuple_for<connect_result_t<stdexec::__cvref_t<_CvrefSenderIds>, __receiver_t>...>;
+       public:
+        template <class _SenderTuple>
+        __t(_SenderTuple&& __senders, _Receiver&& __rcvr) noexcept(__nothrow_construct)
+          : __op_base_t{static_cast<_Receiver&&>(__rcvr)}
+          , __ops_{__senders.apply(
+              [this]<class... _Senders>(_Senders&&... __sndrs) noexcept(__nothrow_construct)
+                -> __opstate_tuple {
+                // Each receiver knows the index of its sender, where it stores the value.
+                return [&]<std::size_t... _Is>(std::index_sequence<_Is...>) -> __opstate_tuple {
+                  return __opstate_tuple{
+                    stdexec::connect(static_cast<_Senders&&>(__sndrs), __receiver_t{this, _Is})...};
+                }(std::index_sequence_for<_Senders...>{});
+              },
+              static_cast<_SenderTuple&&>(__senders))} {
+        }
+
+        void start() & noexcept {
+          this->__on_stop_.emplace(
+            get_stop_token(get_env(this->__rcvr_)), __on_stop_requested{this->__stop_source_});
+          if (this->__stop_source_.stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__rcvr_));
+          } else {
+            __ops_.for_each(stdexec::start, __ops_);
+          }
+        }
+
+       private:
+        __opstate_tuple __ops_;
+      };
+    };
+
+    template <std::size_t _Count, class... _SenderIds>
+    struct __n_sender {
+      template <class _Self, class _Receiver>
+      using __op_t =
+        stdexec::__t<__n_op<_Count, __id<_Receiver>, __copy_cvref_t<_Self, _SenderIds>...>>;
+
+      template <class _Self, class... _Env>
+      using __completions_t = //
+        __minvoke<
+          __when_any::__n_completions_fn<_Count, _Env...>,
+          __copy_cvref_t<_Self, stdexec::__t<_SenderIds>>...>;
+
+      class __t {
+       public:
+        using __id = __n_sender;
+        using sender_concept = stdexec::sender_t;
+        using __senders_tuple = __tuple_for<stdexec::__t<_SenderIds>...>;
+
+        template <__not_decays_to<__t>... _Senders>
+        explicit(sizeof...(_Senders) == 1)
+          __t(_Senders&&... __senders) noexcept((__nothrow_decay_copyable<_Senders> && ...))
+          : __senders_{static_cast<_Senders&&>(__senders)...} {
+        }
+
+        template <__decays_to<__t> _Self, receiver _Receiver>
+        static auto connect(_Self&& __self, _Receiver __rcvr) //
+          noexcept(__nothrow_constructible_from<
+                   __op_t<_Self, _Receiver>,
+                   __copy_cvref_t<_Self, __senders_tuple>,
+                   _Receiver>) -> __op_t<_Self, _Receiver> {
+          return __op_t<_Self, _Receiver>{
+            static_cast<_Self&&>(__self).__senders_, static_cast<_Receiver&&>(__rcvr)};
+        }
+
+        template <__decays_to<__t> _Self, class... _Env>
+        static auto get_completion_signatures(_Self&&, _Env&&...) noexcept
+          -> __completions_t<_Self, _Env...> {
+          return {};
+        }
+
+       private:
+        __senders_tuple __senders_;
+      };
+    };
+
+    template <std::size_t _Count>
+    struct __when_any_n_t {
+      template <class... _Senders>
+      using __sender_t = __t<__n_sender<_Count, __id<__decay_t<_Senders>>...>>;
+
+      template <sender... _Senders>
+        requires(_Count > 0 && sizeof...(_Senders) >= _Count && sender<__sender_t<_Senders...>>)
+      auto operator()(_Senders&&... __senders) const
+        noexcept((__nothrow_decay_copyable<_Senders> && ...)) -> __sender_t<_Senders...> {
+        return __sender_t<_Senders...>(static_cast<_Senders&&>(__senders)...);
+      }
+    };
+
+    //! `when_any(sndrs...)` completes with the first completion of any of `sndrs`, and stops
+    //! the others as soon as it arrives.
+    inline constexpr __when_any_t<false> when_any{};
+
+    //! `when_any_value(sndrs...)` completes with the first value of any of `sndrs`, and stops
+    //! the others as soon as it arrives. Errors and stopped signals are ignored unless none of
+    //! `sndrs` completes with a value, in which case the first of them is forwarded. This suits
+    //! hedged requests, where a failed replica should not fail the request.
+    inline constexpr __when_any_t<true> when_any_value{};
+
+    //! `when_any_n<K>(sndrs...)` completes with a `std::array` of the first `K` values sent by
+    //! `sndrs`, in the order in which they arrived, and stops the other senders as soon as the
+    //! `K`-th value arrives, or as soon as so many senders have failed that fewer than `K`
+    //! values can arrive. In the latter case, it completes with the first error or stopped
+    //! signal. All of `sndrs` must send a single value of the same type.
+    template <std::size_t _Count>
+    inline constexpr __when_any_n_t<_Count> when_any_n{};
   } // namespace __when_any
 
   using __when_any::when_any;
+  using __when_any::when_any_value;
+  using __when_any::when_any_n;
 } // namespace exec
 
 STDEXEC_PRAGMA_POP()
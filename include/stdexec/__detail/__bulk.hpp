@@ -109,6 +109,12 @@ namespace stdexec {
     template <class _Pol, class _Shape, class _Fun>
     __data(const _Pol&, _Shape, _Fun) -> __data<_Pol, _Shape, _Fun>;
 
+    //! Whether the policy allows the calls of the bulk function to be interleaved on a single
+    //! thread, so that the loop over the shape may be vectorized.
+    template <class _Pol>
+    inline constexpr bool __is_unsequenced_policy_v =
+      same_as<_Pol, unsequenced_policy> || same_as<_Pol, parallel_unsequenced_policy>;
+
     template <class _AlgoTag>
     struct __bulk_traits;
 
@@ -215,6 +221,7 @@ namespace stdexec {
       static auto __transform_sender_fn(const _Env&) {
         return [&]<class _Data, class _Child>(__ignore, _Data&& __data, _Child&& __child) {
           using __shape_t = std::remove_cvref_t<decltype(__data.__shape_)>;
+          using __policy_t = std::remove_cvref_t<decltype(__data.__pol_.__get())>;
           auto __new_f = [__func = std::move(__data.__fun_)](
                            __shape_t __begin,
                            __shape_t __end,
@@ -224,8 +231,15 @@ namespace stdexec {
             noexcept(noexcept(__data.__fun_(__begin++, __vs...)))
 #endif
           {
-            while (__begin != __end)
-              __func(__begin++, __vs...);
+            if constexpr (__is_unsequenced_policy_v<__policy_t>) {
+              // A counted loop that the compiler is told it may vectorize.
+              STDEXEC_PRAGMA_SIMD_LOOP()
+              for (__shape_t __i = __begin; __i < __end; ++__i)
+                __func(__i, __vs...);
+            } else {
+              while (__begin != __end)
+                __func(__begin++, __vs...);
+            }
           };
 
           // Lower `bulk` to `bulk_chunked`. If `bulk_chunked` is customized, we will see the customization.
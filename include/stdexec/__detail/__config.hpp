@@ -237,6 +237,22 @@ namespace __coro = std::experimental;
 #  define STDEXEC_PRAGMA_IGNORE_MSVC(...)
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// STDEXEC_PRAGMA_SIMD_LOOP() asserts that the iterations of the loop that follows are free of
+// loop-carried dependencies, as the unsequenced execution policies promise, so that the
+// compiler may vectorize it without proving that itself.
+#if defined(_OPENMP)
+#  define STDEXEC_PRAGMA_SIMD_LOOP() _Pragma("omp simd")
+#elif STDEXEC_CLANG()
+#  define STDEXEC_PRAGMA_SIMD_LOOP() _Pragma("clang loop vectorize(assume_safety)")
+#elif STDEXEC_GCC()
+#  define STDEXEC_PRAGMA_SIMD_LOOP() _Pragma("GCC ivdep")
+#elif STDEXEC_MSVC()
+#  define STDEXEC_PRAGMA_SIMD_LOOP() __pragma(loop(ivdep))
+#else
+#  define STDEXEC_PRAGMA_SIMD_LOOP()
+#endif
+
 #if !STDEXEC_MSVC() && defined(__has_builtin)
 #  define STDEXEC_HAS_BUILTIN __has_builtin
 #else
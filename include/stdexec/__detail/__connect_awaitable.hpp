@@ -21,11 +21,15 @@
 #include "__completion_signatures.hpp"
 #include "__concepts.hpp"
 #include "__config.hpp"
+#include "__env.hpp"
 #include "__meta.hpp"
 #include "__receivers.hpp"
 #include "__tag_invoke.hpp"
 
+#include <cstddef>
 #include <exception>
+#include <memory>
+#include <new>
 #include <utility>
 
 namespace stdexec {
@@ -86,6 +90,50 @@ namespace stdexec {
       }
     };
 
+    //! The unit in which coroutine frames are allocated, so that frames allocated with an
+    //! allocator are aligned like those allocated with `::operator new`.
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __frame_block {
+      std::byte __storage_[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    //! Allocates coroutine frames with an allocator. The allocator is stored behind the frame,
+    //! where the deallocation function, which only gets the frame pointer and its size, can find
+    //! it again.
+    template <class _Allocator>
+    struct __frame_allocator {
+      using __alloc_t =
+        typename std::allocator_traits<_Allocator>::template rebind_alloc<__frame_block>;
+      using __traits_t = std::allocator_traits<__alloc_t>;
+
+      static_assert(alignof(__alloc_t) <= alignof(__frame_block));
+
+      static constexpr auto __offset(std::size_t __size) noexcept -> std::size_t {
+        return (__size + alignof(__alloc_t) - 1) & ~(alignof(__alloc_t) - 1);
+      }
+
+      static constexpr auto __blocks(std::size_t __size) noexcept -> std::size_t {
+        return (__offset(__size) + sizeof(__alloc_t) + sizeof(__frame_block) - 1)
+             / sizeof(__frame_block);
+      }
+
+      static auto __allocate(const _Allocator& __alloc, std::size_t __size) -> void* {
+        __alloc_t __frame_alloc{__alloc};
+        void* __frame = __traits_t::allocate(__frame_alloc, __blocks(__size));
+        ::new (static_cast<void*>(static_cast<std::byte*>(__frame) + __offset(__size)))
+          __alloc_t{static_cast<__alloc_t&&>(__frame_alloc)};
+        return __frame;
+      }
+
+      static void __deallocate(void* __frame, std::size_t __size) noexcept {
+        auto* __stored = std::launder(
+          reinterpret_cast<__alloc_t*>(static_cast<std::byte*>(__frame) + __offset(__size)));
+        __alloc_t __frame_alloc{static_cast<__alloc_t&&>(*__stored)};
+        __stored->~__alloc_t();
+        __traits_t::deallocate(
+          __frame_alloc, static_cast<__frame_block*>(__frame), __blocks(__size));
+      }
+    };
+
     template <class _ReceiverId>
     struct __promise;
 
@@ -104,6 +152,33 @@ namespace stdexec {
       struct __t : __promise_base {
         using __id = __promise;
 
+        // If the environment of the receiver has an allocator, the coroutine frame is allocated
+        // with it. The allocation function gets the arguments of the coroutine.
+        static constexpr bool __with_allocator = __callable<get_allocator_t, env_of_t<_Receiver>>;
+
+        template <class _Awaitable>
+          requires __with_allocator
+        static auto operator new(std::size_t __size, _Awaitable&&, const _Receiver& __rcvr)
+          -> void* {
+          auto __alloc = get_allocator(stdexec::get_env(__rcvr));
+          return __frame_allocator<decltype(__alloc)>::__allocate(__alloc, __size);
+        }
+
+        static auto operator new(std::size_t __size) -> void*
+          requires(!__with_allocator)
+        {
+          return ::operator new(__size);
+        }
+
+        static void operator delete(void* __frame, std::size_t __size) noexcept {
+          if constexpr (__with_allocator) {
+            using __alloc_t = __decay_t<__call_result_t<get_allocator_t, env_of_t<_Receiver>>>;
+            __frame_allocator<__alloc_t>::__deallocate(__frame, __size);
+          } else {
+            ::operator delete(__frame, __size);
+          }
+        }
+
 #  if STDEXEC_EDG()
         __t(auto&&, _Receiver&& __rcvr) noexcept
           : __rcvr_(__rcvr) {
@@ -20,7 +20,6 @@
 // include these after __execution_fwd.hpp
 #include "__basic_sender.hpp"
 #include "__env.hpp"
-#include "__intrusive_slist.hpp"
 #include "__optional.hpp"
 #include "__meta.hpp"
 #include "__receivers.hpp"
@@ -74,11 +73,21 @@ namespace stdexec::__shared {
     };
   }
 
+  //! Whether a waiter is in the waiters list. A waiter that has been started is `__queued`
+  //! before it is pushed onto the list. A stop request that arrives before that marks it as
+  //! `__stopped` instead, and `start` completes it with `set_stopped`.
+  enum class __waiter_state : unsigned char {
+    __idle,
+    __queued,
+    __stopped
+  };
+
   struct __local_state_base : __immovable {
     using __notify_fn = void(__local_state_base*) noexcept;
 
     __notify_fn* __notify_{};
     __local_state_base* __next_{};
+    std::atomic<__waiter_state> __state_{__waiter_state::__idle};
   };
 
   template <class _CvrefSender, class _Env>
@@ -111,17 +120,18 @@ namespace stdexec::__shared {
     void operator()() noexcept {
       // We reach here when a split/ensure_started sender has received a stop request from the
       // receiver to which it is connected.
-      if (std::unique_lock __lock{__sh_state_->__mutex_}) {
-        // Remove this operation from the waiters list. Removal can fail if:
-        //   1. It was already removed by another thread, or
-        //   2. It hasn't been added yet (see `start` below), or
-        //   3. The underlying operation has already completed.
-        //
-        // In each case, the right thing to do is nothing. If (1) then we raced with another
-        // thread and lost. In that case, the other thread will take care of it. If (2) then
-        // `start` will take care of it. If (3) then this stop request is safe to ignore.
-        if (!__sh_state_->__waiters_.remove(this))
-          return;
+      auto __expected = __waiter_state::__idle;
+      if (this->__state_.compare_exchange_strong(
+            __expected, __waiter_state::__stopped, std::memory_order_acq_rel)) {
+        // This operation hasn't been added to the waiters list yet, and now it won't be:
+        // `start` will complete it with set_stopped.
+        return;
+      }
+
+      // Remove this operation from the waiters list. Removal fails if the underlying operation
+      // has already completed, in which case this stop request is safe to ignore.
+      if (!__sh_state_->__try_remove_waiter(this)) {
+        return;
       }
 
       // The following code and the __notify function cannot both execute. This is because the
@@ -196,7 +206,7 @@ namespace stdexec::__shared {
   };
 
   inline auto __get_tombstone() noexcept -> __local_state_base* {
-    static constinit __local_state_base __tombstone_{{}, nullptr, nullptr};
+    static constinit __local_state_base __tombstone_{{}, nullptr, nullptr, {}};
     return &__tombstone_;
   }
 
@@ -204,7 +214,6 @@ namespace stdexec::__shared {
   template <class _CvrefSender, class _Env>
   struct __shared_state {
     using __receiver_t = __t<__receiver<__cvref_id<_CvrefSender>, __id<_Env>>>;
-    using __waiters_list_t = __intrusive_slist<&__local_state_base::__next_>;
 
     using __variant_t = //
       __transform_completion_signatures<
@@ -218,8 +227,11 @@ namespace stdexec::__shared {
     inplace_stop_source __stop_source_{};
     __env_t<_Env> __env_;
     __variant_t __results_{}; // Defaults to the "set_stopped" state
-    std::mutex __mutex_;      // This mutex guards access to __waiters_.
-    __waiters_list_t __waiters_{};
+    // An intrusive stack of the operations waiting for the result, or the tombstone once the
+    // result is available. Waiters are pushed without locking; __mutex_ only serializes the
+    // removal of waiters whose stop tokens are triggered with taking the stack at completion.
+    std::atomic<__local_state_base*> __waiters_{nullptr};
+    std::mutex __mutex_;
     connect_result_t<_CvrefSender, __receiver_t> __shared_op_;
     std::atomic_flag __started_{};
     std::atomic<std::size_t> __ref_count_{2};
@@ -295,20 +307,56 @@ namespace stdexec::__shared {
     }
 
     template <class _StopToken>
-    auto __try_add_waiter(__local_state_base* __waiter, _StopToken __stok) noexcept -> bool {
-      std::unique_lock __lock{__mutex_};
-      if (__waiters_.front() == __get_tombstone()) {
-        // The work has already completed. Notify the waiter immediately.
-        __lock.unlock();
-        __waiter->__notify_(__waiter);
-        return true;
-      } else if (__stok.stop_requested()) {
-        // Stop has been requested. Do not add the waiter.
-        return false;
-      } else {
-        // Add the waiter to the list.
-        __waiters_.push_front(__waiter);
-        return true;
+    auto __try_add_waiter(__local_state_base* __waiter, _StopToken) noexcept -> bool {
+      if constexpr (!unstoppable_token<_StopToken>) {
+        auto __expected = __waiter_state::__idle;
+        if (!__waiter->__state_.compare_exchange_strong(
+              __expected, __waiter_state::__queued, std::memory_order_acq_rel)) {
+          // Stop has been requested. Do not add the waiter.
+          return false;
+        }
+      }
+
+      // Once it is on the list the waiter may be notified and destroyed at any time, so neither
+      // the waiter nor this shared state may be touched after the push succeeds.
+      auto* __head = __waiters_.load(std::memory_order_acquire);
+      do {
+        if (__head == __get_tombstone()) {
+          // The work has already completed. Notify the waiter immediately.
+          __waiter->__notify_(__waiter);
+          return true;
+        }
+        __waiter->__next_ = __head;
+      } while (!__waiters_.compare_exchange_weak(
+        __head, __waiter, std::memory_order_release, std::memory_order_acquire));
+      return true;
+    }
+
+    /// @brief Unlinks a queued waiter whose stop token has been triggered.
+    /// @return false if the waiters have already been notified, or are being notified.
+    auto __try_remove_waiter(__local_state_base* __waiter) noexcept -> bool {
+      std::lock_guard __lock{__mutex_};
+      for (__stok::__spin_wait __spin;; __spin.__wait()) {
+        auto* __head = __waiters_.load(std::memory_order_acquire);
+        if (__head == __get_tombstone()) {
+          return false;
+        }
+        if (__head == __waiter) {
+          // Waiters pushed concurrently make this fail, after which __waiter is further down.
+          if (__waiters_.compare_exchange_strong(
+                __head, __waiter->__next_, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+          }
+          continue;
+        }
+        // Only the head of the stack is modified without holding the mutex.
+        for (auto* __prev = __head; __prev; __prev = __prev->__next_) {
+          if (__prev->__next_ == __waiter) {
+            __prev->__next_ = __waiter->__next_;
+            return true;
+          }
+        }
+        // __waiter is queued but its push has not landed yet.
       }
     }
 
@@ -330,22 +378,20 @@ namespace stdexec::__shared {
     /// @brief This is called when the shared async operation completes.
     /// @post __waiters_ is set to a known "tombstone" value.
     void __notify_waiters() noexcept {
-      __waiters_list_t __waiters_copy{__get_tombstone()};
+      __local_state_base* __waiters = nullptr;
 
-      // Set the waiters list to a known "tombstone" value that we can check later.
+      // Set the waiters list to a known "tombstone" value that we can check later. Waiters that
+      // arrive from now on are notified inline. Taking the lock waits out concurrent removals.
       {
         std::lock_guard __lock{__mutex_};
-        __waiters_.swap(__waiters_copy);
+        __waiters = __waiters_.exchange(__get_tombstone(), std::memory_order_acq_rel);
       }
 
-      STDEXEC_ASSERT(__waiters_copy.front() != __get_tombstone());
-      for (auto __itr = __waiters_copy.begin(); __itr != __waiters_copy.end();) {
-        __local_state_base* __item = *__itr;
-
-        // We must increment the iterator before calling notify, since notify may end up
-        // triggering *__item to be destructed on another thread, and the intrusive slist's
-        // iterator increment relies on __item.
-        ++__itr;
+      STDEXEC_ASSERT(__waiters != __get_tombstone());
+      while (__waiters) {
+        // We must read the next pointer before calling notify, since notify may end up
+        // triggering *__waiters to be destructed on another thread.
+        __local_state_base* __item = std::exchange(__waiters, __waiters->__next_);
         __item->__notify_(__item);
       }
 
@@ -61,14 +61,13 @@ namespace stdexec {
     };
 
     template <class _Env>
-    auto __mkenv(_Env&& __env, const inplace_stop_source& __stop_source) noexcept {
-      return __env::__join(
-        prop{get_stop_token, __stop_source.get_token()}, static_cast<_Env&&>(__env));
+    auto __mkenv(_Env&& __env, inplace_stop_token __token) noexcept {
+      return __env::__join(prop{get_stop_token, __token}, static_cast<_Env&&>(__env));
     }
 
     template <class _Env>
     using __env_t = //
-      decltype(__when_all::__mkenv(__declval<_Env>(), __declval<inplace_stop_source&>()));
+      decltype(__when_all::__mkenv(__declval<_Env>(), __declval<inplace_stop_token>()));
 
     template <class _Sender, class _Env>
     concept __max1_sender =
@@ -175,6 +174,11 @@ namespace stdexec {
           __error_types_of_t<_Senders, __env_t<_Env>, __q<__types>>...>;
 
       using __errors_variant = __mapply<__q<__uniqued_variant_for>, __errors_list>;
+
+      //! Whether a child can complete with an error or a stopped signal, either of which asks
+      //! the other children to stop.
+      static constexpr bool __children_may_stop =
+        !__same_as<__errors_list, __types<>> || (sends_stopped<_Senders, __env_t<_Env>> || ...);
     };
 
     struct _INVALID_ARGUMENTS_TO_WHEN_ALL_ { };
@@ -217,6 +221,9 @@ namespace stdexec {
       }
 
       std::atomic<std::size_t> __count_;
+      // Whether __stop_source_ can be asked to stop. If not, the children are given a token
+      // without a source, so that they do not register stop callbacks with it.
+      bool __stop_possible_;
       inplace_stop_source __stop_source_{};
       // Could be non-atomic here and atomic_ref everywhere except __completion_fn
       std::atomic<__state_t> __state_{__started};
@@ -226,13 +233,17 @@ namespace stdexec {
     };
 
     template <class _Env>
-    static auto __mk_state_fn(const _Env&) noexcept {
-      return []<__max1_sender<__env_t<_Env>>... _Child>(__ignore, __ignore, _Child&&...) {
+    static auto __mk_state_fn(const _Env& __env) noexcept {
+      return [&__env]<__max1_sender<__env_t<_Env>>... _Child>(__ignore, __ignore, _Child&&...) {
         using _Traits = __traits<_Env, _Child...>;
         using _ErrorsVariant = typename _Traits::__errors_variant;
         using _ValuesTuple = typename _Traits::__values_tuple;
         using _State = __when_all_state<_ErrorsVariant, _ValuesTuple, stop_token_of_t<_Env>>;
-        return _State{sizeof...(_Child)};
+        // Stop can only be requested by a failing child or through the receiver's stop token.
+        // The check is constant for unstoppable tokens like never_stop_token.
+        const bool __stop_possible =
+          _Traits::__children_may_stop || get_stop_token(__env).stop_possible();
+        return _State{sizeof...(_Child), __stop_possible};
       };
     }
 
@@ -281,7 +292,9 @@ namespace stdexec {
           _State& __state,
           const _Receiver& __rcvr) noexcept //
         -> __env_t<env_of_t<const _Receiver&>> {
-        return __mkenv(stdexec::get_env(__rcvr), __state.__stop_source_);
+        return __mkenv(
+          stdexec::get_env(__rcvr),
+          __state.__stop_possible_ ? __state.__stop_source_.get_token() : inplace_stop_token{});
       };
 
       static constexpr auto get_state = //
@@ -4,6 +4,7 @@
 #include <exec/just_from.hpp>
 #include <exec/static_thread_pool.hpp>
 #include <exec/just_from.hpp>
+#include "test_common/allocators.hpp"
 #include "test_common/schedulers.hpp"
 #include "test_common/receivers.hpp"
 
@@ -464,4 +465,49 @@ namespace {
     // ex::start(op);
     expect_empty(scope);
   }
+
+  TEST_CASE(
+    "spawn_future allocates its state with the allocator of the environment",
+    "[async_scope][spawn_future]") {
+    impulse_scheduler sch;
+    async_scope scope;
+    auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{}};
+    counting_allocator<std::byte>::allocations = 0;
+    counting_allocator<std::byte>::deallocations = 0;
+
+    SECTION("the future is awaited after the work completes") {
+      ex::sender auto snd = scope.spawn_future(ex::starts_on(sch, ex::just(13)), env);
+      CHECK(counting_allocator<std::byte>::allocations == 1);
+      sch.start_next();
+      CHECK(counting_allocator<std::byte>::deallocations == 0);
+      wait_for_value(std::move(snd), 13);
+    }
+
+    SECTION("the future is awaited before the work completes") {
+      ex::sender auto snd = scope.spawn_future(ex::starts_on(sch, ex::just(13)), env);
+      auto op = ex::connect(std::move(snd), expect_value_receiver{13});
+      ex::start(op);
+      CHECK(counting_allocator<std::byte>::deallocations == 0);
+      sch.start_next();
+    }
+
+    SECTION("the future is dropped before the work completes") {
+      {
+        ex::sender auto snd = scope.spawn_future(ex::starts_on(sch, ex::just(13)), env);
+        (void) snd;
+      }
+      CHECK(counting_allocator<std::byte>::deallocations == 0);
+      sch.start_next();
+    }
+
+    SECTION("spawn uses the allocator too") {
+      scope.spawn(ex::starts_on(sch, ex::just()), env);
+      CHECK(counting_allocator<std::byte>::allocations == 1);
+      sch.start_next();
+    }
+
+    CHECK(counting_allocator<std::byte>::allocations == 1);
+    CHECK(counting_allocator<std::byte>::deallocations == 1);
+    expect_empty(scope);
+  }
 } // namespace
@@ -16,14 +16,18 @@
 
 #include <exec/any_sender_of.hpp>
 #include <exec/inline_scheduler.hpp>
+#include <exec/recycling_allocator.hpp>
 #include <exec/when_any.hpp>
 #include <exec/static_thread_pool.hpp>
 
+#include <test_common/allocators.hpp>
 #include <test_common/schedulers.hpp>
 #include <test_common/receivers.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <array>
+
 using namespace stdexec;
 using namespace exec;
 
@@ -297,6 +301,73 @@ namespace {
     CHECK_THROWS_AS(sync_wait(std::move(sender)), int);
   }
 
+  template <std::size_t SenderSize, std::size_t OperationSize, class Allocator>
+  using sized_sender_of = any_receiver_ref<completion_signatures<set_value_t(int)>>::any_sender<
+    any_sender_storage<SenderSize, OperationSize, Allocator>{}>;
+
+  TEST_CASE("any_sender storage sizes are configurable", "[types][any_sender]") {
+    std::array<int, 16> payload{};
+    payload[15] = 42;
+    auto make_sender = [payload] {
+      return just() | then([payload]() noexcept { return payload[15]; });
+    };
+    counting_allocator<std::byte>::allocations = 0;
+
+    SECTION("objects that do not fit are allocated") {
+      sized_sender_of<3 * sizeof(void*), 6 * sizeof(void*), counting_allocator<std::byte>> sender =
+        make_sender();
+      CHECK(counting_allocator<std::byte>::allocations == 1);
+      auto [value] = sync_wait(std::move(sender)).value();
+      CHECK(value == 42);
+      CHECK(counting_allocator<std::byte>::allocations == 2);
+    }
+
+    SECTION("objects that fit are stored inline") {
+      sized_sender_of<128, 256, counting_allocator<std::byte>> sender = make_sender();
+      auto [value] = sync_wait(std::move(sender)).value();
+      CHECK(value == 42);
+      CHECK(counting_allocator<std::byte>::allocations == 0);
+    }
+
+    SECTION("with the recycling allocator") {
+      for (int i = 0; i < 3; ++i) {
+        sized_sender_of<8, 8, recycling_allocator<std::byte>> sender = make_sender();
+        auto [value] = sync_wait(std::move(sender)).value();
+        CHECK(value == 42);
+      }
+    }
+  }
+
+  TEST_CASE("any_sender storage is passed alongside sender queries", "[types][any_sender]") {
+    using sender_t = any_receiver_ref<completion_signatures<set_value_t()>>::any_sender<
+      any_sender_storage<64, 128>{},
+      get_completion_scheduler<set_value_t>.signature<inline_scheduler() noexcept>>;
+    sender_t sender = schedule(inline_scheduler{});
+    CHECK(get_completion_scheduler<set_value_t>(get_env(sender)) == inline_scheduler{});
+    CHECK(sync_wait(std::move(sender)).has_value());
+  }
+
+  TEST_CASE("any_scheduler passes its storage on to the schedule-sender", "[types][any_sender]") {
+    exec::static_thread_pool pool(1);
+    counting_allocator<std::byte>::allocations = 0;
+
+    SECTION("objects that do not fit are allocated") {
+      using scheduler_t = any_receiver_ref<completion_signatures<set_stopped_t()>>::any_sender<
+        any_sender_storage<8, 8, counting_allocator<std::byte>>{}>::any_scheduler<>;
+      scheduler_t scheduler = pool.get_scheduler();
+      CHECK(sync_wait(schedule(scheduler)).has_value());
+      CHECK(counting_allocator<std::byte>::allocations == 2);
+    }
+
+    SECTION("objects that fit are stored inline") {
+      using scheduler_t = any_receiver_ref<completion_signatures<set_stopped_t()>>::any_sender<
+        any_sender_storage<64, 256, counting_allocator<std::byte>>{}>::any_scheduler<>;
+      scheduler_t scheduler = pool.get_scheduler();
+      CHECK(sync_wait(schedule(scheduler)).has_value());
+      CHECK(counting_allocator<std::byte>::allocations == 0);
+    }
+  }
+
   TEST_CASE("any_sender is connectable with any_receiver_ref", "[types][any_sender]") {
     using Sigs = completion_signatures<set_value_t(int), set_stopped_t()>;
     using receiver_ref = any_receiver_ref<Sigs>;
@@ -596,6 +667,16 @@ namespace {
     CHECK(called);
   }
 
+  TEST_CASE("any scheduler compares equal to the scheduler it holds", "[types][any_sender]") {
+    exec::static_thread_pool pool(1);
+    exec::static_thread_pool other_pool(1);
+    stoppable_scheduler<> scheduler = pool.get_scheduler();
+    CHECK(scheduler == pool.get_scheduler());
+    CHECK(pool.get_scheduler() == scheduler);
+    CHECK(scheduler != other_pool.get_scheduler());
+    CHECK(scheduler != exec::inline_scheduler{});
+  }
+
   TEST_CASE("queryable any_scheduler with static_thread_pool", "[types][any_sender]") {
     using my_scheduler =
       stoppable_scheduler<get_forward_progress_guarantee.signature<forward_progress_guarantee()>>;
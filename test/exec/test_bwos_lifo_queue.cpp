@@ -18,6 +18,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 TEST_CASE("exec::bwos::lifo_queue - ", "[bwos]") {
   exec::bwos::lifo_queue<int*> queue(8, 2);
   int x = 1;
@@ -77,4 +81,88 @@ TEST_CASE("exec::bwos::lifo_queue - ", "[bwos]") {
     CHECK(queue.pop_back() == &y);
     CHECK(queue.pop_back() == nullptr);
   }
+  SECTION("Empty Steal Block") {
+    int* stolen[2]{};
+    CHECK(queue.steal_block(stolen, 2) == stolen);
+  }
+  SECTION("Put one, steal block none") {
+    int* stolen[2]{};
+    CHECK(queue.push_back(&x));
+    CHECK(queue.steal_block(stolen, 2) == stolen);
+    CHECK(queue.pop_back() == &x);
+  }
+  SECTION("Put 5, Steal Block 2, Steal Block 2, Get 1") {
+    int* stolen[2]{};
+    CHECK(queue.push_back(&x));
+    CHECK(queue.push_back(&y));
+    CHECK(queue.push_back(&x));
+    CHECK(queue.push_back(&y));
+    CHECK(queue.push_back(&x));
+    CHECK(queue.steal_block(stolen, 2) == stolen + 2);
+    CHECK(stolen[0] == &x);
+    CHECK(stolen[1] == &y);
+    CHECK(queue.steal_block(stolen, 2) == stolen + 2);
+    CHECK(stolen[0] == &x);
+    CHECK(stolen[1] == &y);
+    CHECK(queue.steal_block(stolen, 2) == stolen);
+    CHECK(queue.pop_back() == &x);
+    CHECK(queue.pop_back() == nullptr);
+  }
+  SECTION("Put 3, Steal Block at most 1, Steal 1, Get 1") {
+    int* stolen[2]{};
+    CHECK(queue.push_back(&x));
+    CHECK(queue.push_back(&y));
+    CHECK(queue.push_back(&x));
+    CHECK(queue.steal_block(stolen, 1) == stolen + 1);
+    CHECK(stolen[0] == &x);
+    CHECK(queue.steal_front() == &y);
+    CHECK(queue.steal_front() == nullptr);
+    CHECK(queue.pop_back() == &x);
+    CHECK(queue.pop_back() == nullptr);
+  }
+  SECTION("Put 4, Steal 1, Steal Block the rest, Get 2") {
+    int* stolen[2]{};
+    CHECK(queue.push_back(&x));
+    CHECK(queue.push_back(&y));
+    CHECK(queue.push_back(&x));
+    CHECK(queue.push_back(&y));
+    CHECK(queue.steal_front() == &x);
+    CHECK(queue.steal_block(stolen, 2) == stolen + 1);
+    CHECK(stolen[0] == &y);
+    CHECK(queue.pop_back() == &y);
+    CHECK(queue.pop_back() == &x);
+    CHECK(queue.pop_back() == nullptr);
+  }
+}
+
+TEST_CASE("exec::bwos::lifo_queue - steal blocks concurrently", "[bwos]") {
+  constexpr int n_values = 10'000;
+  exec::bwos::lifo_queue<int*> queue(4, 8);
+  std::vector<int> values(n_values);
+  std::vector<std::atomic<int>> seen(n_values);
+  std::atomic<bool> done{false};
+  std::thread thief{[&] {
+    int* stolen[8]{};
+    while (!done.load()) {
+      int** last = queue.steal_block(stolen, 8);
+      for (int** it = stolen; it != last; ++it) {
+        seen[static_cast<std::size_t>(*it - values.data())].fetch_add(1);
+      }
+    }
+  }};
+  for (int i = 0; i < n_values;) {
+    if (queue.push_back(&values[static_cast<std::size_t>(i)])) {
+      ++i;
+    } else if (int* value = queue.pop_back()) {
+      seen[static_cast<std::size_t>(value - values.data())].fetch_add(1);
+    }
+  }
+  while (int* value = queue.pop_back()) {
+    seen[static_cast<std::size_t>(value - values.data())].fetch_add(1);
+  }
+  done.store(true);
+  thief.join();
+  for (auto& count: seen) {
+    CHECK(count.load() == 1);
+  }
 }
\ No newline at end of file
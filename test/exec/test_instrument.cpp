@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/instrument.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  auto find_stage(const std::vector<exec::latency_stage_snapshot>& stages, const char* label)
+    -> const exec::latency_stage_snapshot* {
+    for (const auto& stage: stages) {
+      if (std::strcmp(stage.label, label) == 0) {
+        return &stage;
+      }
+    }
+    return nullptr;
+  }
+
+  TEST_CASE("latency_histogram buckets values with bounded relative error", "[instrument]") {
+    using histogram = exec::latency_histogram;
+    for (std::uint64_t value = 0; value < 16; ++value) {
+      CHECK(histogram::bucket_of(value) == value);
+    }
+    CHECK(histogram::bucket_of(16) == 16);
+    CHECK(histogram::bucket_of(31) == 31);
+    CHECK(histogram::bucket_of(32) == 32);
+    CHECK(histogram::bucket_of(34) == 33);
+    CHECK(histogram::bucket_of(UINT64_MAX) == histogram::bucket_count - 1);
+    const std::vector<std::uint64_t> values{17, 100, 1000, 123'456'789, UINT64_MAX / 3};
+    for (std::uint64_t value: values) {
+      const std::size_t bucket = histogram::bucket_of(value);
+      CHECK(histogram::lowest_value(bucket) <= value);
+      CHECK(value <= histogram::highest_value(bucket));
+      CHECK(histogram::highest_value(bucket) - histogram::lowest_value(bucket) <= value / 16);
+      CHECK(histogram::bucket_of(histogram::highest_value(bucket) + 1) == bucket + 1);
+    }
+  }
+
+  TEST_CASE("latency_histogram computes percentiles", "[instrument]") {
+    exec::latency_histogram histogram;
+    CHECK(histogram.get_snapshot().percentile(0.5) == 0);
+    for (std::uint64_t value = 1; value <= 1000; ++value) {
+      histogram.record(value);
+    }
+    auto snapshot = histogram.get_snapshot();
+    CHECK(snapshot.count == 1000);
+    CHECK(snapshot.sum == 500'500);
+    CHECK(snapshot.min == 1);
+    CHECK(snapshot.max == 1000);
+    CHECK(snapshot.mean() == Approx(500.5));
+    CHECK(snapshot.percentile(0.0) == 1);
+    CHECK(snapshot.percentile(0.5) >= 500);
+    CHECK(snapshot.percentile(0.5) <= 500 + 500 / 16);
+    CHECK(snapshot.percentile(0.99) >= 990);
+    CHECK(snapshot.percentile(1.0) == 1000);
+    histogram.reset();
+    CHECK(histogram.get_snapshot().count == 0);
+  }
+
+  TEST_CASE("latency_histogram can be recorded from many threads", "[instrument]") {
+    exec::latency_histogram histogram;
+    std::vector<std::thread> threads;
+    for (std::uint64_t t = 0; t < 4; ++t) {
+      threads.emplace_back([&histogram, t] {
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+          histogram.record(t * 1000 + i);
+        }
+      });
+    }
+    for (auto& thread: threads) {
+      thread.join();
+    }
+    auto snapshot = histogram.get_snapshot();
+    CHECK(snapshot.count == 4000);
+    CHECK(snapshot.min == 0);
+    CHECK(snapshot.max == 3999);
+  }
+
+  TEST_CASE("instrument records nothing while the sink is disabled", "[instrument]") {
+    exec::latency_sink sink{false};
+    CHECK_FALSE(sink.enabled());
+    auto [value] = ex::sync_wait(exec::instrument(ex::just(42), sink, "disabled")).value();
+    CHECK(value == 42);
+    // The label is not even looked up.
+    CHECK(sink.snapshot().empty());
+  }
+
+  TEST_CASE("instrument records per label", "[instrument]") {
+    exec::latency_sink sink;
+    std::string label = "just";
+    for (int i = 0; i < 3; ++i) {
+      ex::sync_wait(ex::just() | exec::instrument(sink, "just"));
+    }
+    // Labels are compared by their contents.
+    ex::sync_wait(exec::instrument(ex::just(), sink, label.c_str()));
+    ex::sync_wait(ex::just() | exec::instrument(sink, "other"));
+    auto stages = sink.snapshot();
+    CHECK(stages.size() == 2);
+    auto* just = find_stage(stages, "just");
+    REQUIRE(just != nullptr);
+    CHECK(just->connect_to_start.count == 4);
+    CHECK(just->start_to_completion.count == 4);
+    // just() completes inline, so it has no queueing time.
+    CHECK(just->queueing.count == 0);
+    REQUIRE(find_stage(stages, "other") != nullptr);
+    sink.reset();
+    stages = sink.snapshot();
+    CHECK(find_stage(stages, "just")->start_to_completion.count == 0);
+  }
+
+  TEST_CASE("labels beyond the capacity of the sink are counted together", "[instrument]") {
+    exec::latency_sink sink{true, 2};
+    ex::sync_wait(ex::just() | exec::instrument(sink, "a"));
+    ex::sync_wait(ex::just() | exec::instrument(sink, "b"));
+    ex::sync_wait(ex::just() | exec::instrument(sink, "c"));
+    ex::sync_wait(ex::just() | exec::instrument(sink, "d"));
+    auto stages = sink.snapshot();
+    CHECK(stages.size() == 3);
+    auto* other = find_stage(stages, "(other)");
+    REQUIRE(other != nullptr);
+    CHECK(other->start_to_completion.count == 2);
+  }
+
+  TEST_CASE("instrument records the queueing time of a scheduler hop", "[instrument]") {
+    exec::static_thread_pool pool{2};
+    exec::latency_sink sink;
+    for (int i = 0; i < 20; ++i) {
+      auto [value] = ex::sync_wait(
+                       ex::schedule(pool.get_scheduler()) | ex::then([] { return 42; })
+                       | exec::instrument(sink, "pool"))
+                       .value();
+      CHECK(value == 42);
+    }
+    auto stages = sink.snapshot();
+    auto* pool_stage = find_stage(stages, "pool");
+    REQUIRE(pool_stage != nullptr);
+    CHECK(pool_stage->start_to_completion.count == 20);
+    CHECK(pool_stage->queueing.count == 20);
+    CHECK(pool_stage->queueing.max <= pool_stage->start_to_completion.max);
+  }
+
+  TEST_CASE("instrument does not count work on the scheduler of the receiver", "[instrument]") {
+    exec::static_thread_pool pool{1};
+    exec::latency_sink sink;
+    auto sched = pool.get_scheduler();
+    ex::sync_wait(ex::starts_on(
+      sched, ex::schedule(sched) | exec::instrument(sink, "same") | ex::then([] { })));
+    auto stages = sink.snapshot();
+    auto* same = find_stage(stages, "same");
+    REQUIRE(same != nullptr);
+    CHECK(same->start_to_completion.count == 1);
+    CHECK(same->queueing.count == 0);
+  }
+
+  TEST_CASE("write_latency_json writes the percentiles of every label", "[instrument]") {
+    exec::latency_sink sink;
+    ex::sync_wait(ex::just() | exec::instrument(sink, "a \"quoted\" label"));
+    std::ostringstream out;
+    exec::write_latency_json(out, sink.snapshot());
+    std::string json = out.str();
+    CHECK(json.starts_with("{\"stages\":[\n{\"label\":\"a \\\"quoted\\\" label\","));
+    CHECK(json.find("\"start_to_completion\":{\"count\":1,\"mean\":") != std::string::npos);
+    CHECK(
+      json.find("\"queueing\":{\"count\":0,\"mean\":0,\"min\":0,\"p50\":0,")
+      != std::string::npos);
+    CHECK(json.find("\"p999\":") != std::string::npos);
+    CHECK(json.ends_with("\n]}\n"));
+
+    // Control characters are escaped as well.
+    ex::sync_wait(ex::just() | exec::instrument(sink, "a\ttab"));
+    std::ostringstream escaped;
+    exec::write_latency_json(escaped, sink.snapshot());
+    CHECK(escaped.str().find("{\"label\":\"a\\u0009tab\",") != std::string::npos);
+  }
+} // namespace
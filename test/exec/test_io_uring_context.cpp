@@ -29,6 +29,16 @@
 
 #  include "catch2/catch.hpp"
 
+#  include <netinet/in.h>
+#  include <sys/mman.h>
+#  include <sys/socket.h>
+
+#  include <array>
+#  include <numeric>
+#  include <span>
+#  include <system_error>
+#  include <vector>
+
 using namespace stdexec;
 using namespace exec;
 using namespace std::chrono_literals;
@@ -66,6 +76,60 @@ namespace {
     }
   };
 
+  auto make_pipe() -> std::array<safe_file_descriptor, 2> {
+    int fds[2];
+    REQUIRE(::pipe2(fds, O_CLOEXEC) == 0);
+    return {safe_file_descriptor{fds[0]}, safe_file_descriptor{fds[1]}};
+  }
+
+  auto make_socketpair() -> std::array<safe_file_descriptor, 2> {
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) == 0);
+    return {safe_file_descriptor{fds[0]}, safe_file_descriptor{fds[1]}};
+  }
+
+  // Zero-copy sends are not supported on unix domain sockets, so we connect two
+  // TCP sockets over the loopback device instead.
+  auto make_tcp_pair() -> std::array<safe_file_descriptor, 2> {
+    safe_file_descriptor listener{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    REQUIRE(listener);
+    ::sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::socklen_t len = sizeof(addr);
+    REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&addr), len) == 0);
+    REQUIRE(::listen(listener, 1) == 0);
+    REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &len) == 0);
+    safe_file_descriptor client{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    REQUIRE(client);
+    REQUIRE(::connect(client, reinterpret_cast<::sockaddr*>(&addr), len) == 0);
+    safe_file_descriptor server{::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC)};
+    REQUIRE(server);
+    return {std::move(client), std::move(server)};
+  }
+
+  auto make_payload(std::size_t size) -> std::vector<std::byte> {
+    std::vector<std::byte> payload(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      payload[i] = static_cast<std::byte>(i * 31 % 251);
+    }
+    return payload;
+  }
+
+  auto read_exactly(int fd, std::size_t size) -> std::vector<std::byte> {
+    std::vector<std::byte> result(size);
+    std::size_t n_read = 0;
+    while (n_read < size) {
+      ::ssize_t n = ::read(fd, result.data() + n_read, size - n_read);
+      if (n <= 0) {
+        break;
+      }
+      n_read += static_cast<std::size_t>(n);
+    }
+    result.resize(n_read);
+    return result;
+  }
+
   TEST_CASE("io_uring_context - unused context", "[types][io_uring][schedulers]") {
     io_uring_context context;
     CHECK(context.is_running() == false);
@@ -340,6 +404,333 @@ namespace {
     }
   }
 
+#  ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+  TEST_CASE("io_uring_context - send_zc", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    auto [client, server] = make_tcp_pair();
+    const auto payload = make_payload(64 * 1024);
+    std::vector<std::byte> received;
+    {
+      jthread reader{[&, fd = int(server)] {
+        received = read_exactly(fd, payload.size());
+      }};
+      std::size_t total = 0;
+      while (total < payload.size()) {
+        auto result = sync_wait(scheduler.send_zc(client, std::span{payload}.subspan(total)));
+        REQUIRE(result);
+        auto [n_sent] = *result;
+        REQUIRE(n_sent > 0);
+        total += n_sent;
+      }
+      CHECK(total == payload.size());
+    }
+    CHECK(received == payload);
+  }
+
+  TEST_CASE("io_uring_context - send_zc reports errors", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    auto [client, server] = make_tcp_pair();
+    // Sending on a socket that was shut down for writing fails with EPIPE.
+    REQUIRE(::shutdown(client, SHUT_WR) == 0);
+    const auto payload = make_payload(16);
+    int error = 0;
+    sync_wait(when_all(
+      scheduler.send_zc(client, payload, MSG_NOSIGNAL) | then([](std::size_t) { })
+        | upon_error([&](std::exception_ptr eptr) {
+            try {
+              std::rethrow_exception(eptr);
+            } catch (const std::system_error& e) {
+              error = e.code().value();
+            }
+          }),
+      context.run(until::empty)));
+    CHECK(error == EPIPE);
+  }
+#  endif
+
+#  ifdef STDEXEC_HAS_IORING_OP_SPLICE
+  TEST_CASE("io_uring_context - splice from a pipe to a socket", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    auto [pipe_read, pipe_write] = make_pipe();
+    auto [sock0, sock1] = make_socketpair();
+    const auto payload = make_payload(4096);
+    REQUIRE(::write(pipe_write, payload.data(), payload.size()) == ::ssize_t(payload.size()));
+    std::size_t n_spliced = 0;
+    sync_wait(when_all(
+      scheduler.splice(pipe_read, -1, sock0, -1, payload.size())
+        | then([&](std::size_t n) { n_spliced = n; }),
+      context.run(until::empty)));
+    CHECK(n_spliced == payload.size());
+    CHECK(read_exactly(sock1, n_spliced) == payload);
+  }
+
+  TEST_CASE("io_uring_context - sendfile to a socket", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    // Larger than a pipe's capacity to force several round trips
+    const auto payload = make_payload(300 * 1024 + 17);
+    safe_file_descriptor file{::memfd_create("sendfile", MFD_CLOEXEC)};
+    REQUIRE(file);
+    REQUIRE(::write(file, payload.data(), payload.size()) == ::ssize_t(payload.size()));
+    auto [sock0, sock1] = make_socketpair();
+    std::vector<std::byte> received;
+    std::size_t n_transferred = 0;
+
+    SECTION("transfers the requested range") {
+      jthread reader{[&, fd = int(sock1)] {
+        received = read_exactly(fd, payload.size() - 100);
+      }};
+      auto [n] = *sync_wait(scheduler.sendfile(sock0, file, 100, payload.size() - 100));
+      n_transferred = n;
+    }
+
+    SECTION("stops at the end of the file") {
+      jthread reader{[&, fd = int(sock1)] {
+        received = read_exactly(fd, payload.size() - 100);
+      }};
+      auto [n] = *sync_wait(scheduler.sendfile(sock0, file, 100, 2 * payload.size()));
+      n_transferred = n;
+    }
+
+    CHECK(n_transferred == payload.size() - 100);
+    CHECK(std::ranges::equal(received, std::span{payload}.subspan(100)));
+  }
+
+  TEST_CASE(
+    "io_uring_context - stopping the context stops a sendfile in flight",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    // Nobody reads from the socket, so the sendfile re-submits itself until the socket buffer
+    // is full and then waits for the kernel.
+    const auto payload = make_payload(4 * 1024 * 1024);
+    safe_file_descriptor file{::memfd_create("sendfile", MFD_CLOEXEC)};
+    REQUIRE(file);
+    REQUIRE(::write(file, payload.data(), payload.size()) == ::ssize_t(payload.size()));
+    auto [sock0, sock1] = make_socketpair();
+    bool is_stopped = false;
+    {
+      jthread io_thread{[&] {
+        context.run_until_stopped();
+      }};
+      single_thread_context stopper{};
+      sync_wait(when_all(
+        scheduler.sendfile(sock0, file, 0, payload.size()) | then([](std::size_t) { })
+          | upon_stopped([&] { is_stopped = true; }),
+        schedule_after(scheduler, 10ms) | continues_on(stopper.get_scheduler())
+          | then([&] { context.request_stop(); })));
+    }
+    CHECK(is_stopped);
+  }
+#  endif
+
+#  ifdef STDEXEC_HAS_IORING_OP_TEE
+  TEST_CASE("io_uring_context - tee duplicates pipe contents", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    auto [in_read, in_write] = make_pipe();
+    auto [out_read, out_write] = make_pipe();
+    const auto payload = make_payload(1024);
+    REQUIRE(::write(in_write, payload.data(), payload.size()) == ::ssize_t(payload.size()));
+    std::size_t n_teed = 0;
+    sync_wait(when_all(
+      scheduler.tee(in_read, out_write, payload.size()) | then([&](std::size_t n) { n_teed = n; }),
+      context.run(until::empty)));
+    CHECK(n_teed == payload.size());
+    CHECK(read_exactly(out_read, n_teed) == payload);
+    CHECK(read_exactly(in_read, payload.size()) == payload);
+  }
+#  endif
+
+  TEST_CASE(
+    "io_uring_context - in-flight operations are not bounded by the completion queue size",
+    "[types][io_uring][schedulers]") {
+    // 4 submission queue entries and 8 completion queue entries
+    io_uring_context context{4, 0, 8};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    constexpr int n_timers = 64;
+    std::atomic<int> n_stopped = 0;
+    for (int i = 0; i < n_timers; ++i) {
+      start_detached(schedule_after(scheduler, 1h) | upon_stopped([&] { ++n_stopped; }));
+    }
+    {
+      jthread io_thread{[&] {
+        context.run_until_stopped();
+      }};
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      bool is_called = false;
+      sync_wait(schedule(scheduler) | then([&] { is_called = true; }));
+      CHECK(is_called);
+      while (context.get_statistics().pending > 0) {
+        sync_wait(schedule(scheduler));
+      }
+      auto stats = context.get_statistics();
+      CHECK(stats.in_flight >= n_timers);
+      CHECK(stats.max_pending >= n_timers - 4);
+      CHECK(stats.dropped == 0);
+    }
+    CHECK(n_stopped == n_timers);
+  }
+
+  TEST_CASE("io_uring_context - busy polling", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    context.set_busy_poll_duration(1ms);
+    CHECK(context.busy_poll_duration() == 1ms);
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    for (int i = 0; i < 10; ++i) {
+      bool is_called = false;
+      sync_wait(schedule(scheduler) | then([&] {
+                  CHECK(io_thread.get_id() == std::this_thread::get_id());
+                  is_called = true;
+                }));
+      CHECK(is_called);
+      is_called = false;
+      sync_wait(schedule_after(scheduler, 2ms) | then([&] {
+                  CHECK(io_thread.get_id() == std::this_thread::get_id());
+                  is_called = true;
+                }));
+      CHECK(is_called);
+    }
+  }
+
+  TEST_CASE("io_uring_context - IOPOLL context", "[types][io_uring][schedulers]") {
+    io_uring_context context{64, IORING_SETUP_IOPOLL};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    {
+      jthread io_thread{[&] {
+        context.run_until_stopped();
+      }};
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      for (int i = 0; i < 10; ++i) {
+        bool is_called = false;
+        sync_wait(schedule(scheduler) | then([&] {
+                    CHECK(io_thread.get_id() == std::this_thread::get_id());
+                    is_called = true;
+                  }));
+        CHECK(is_called);
+      }
+    }
+    CHECK(!context.is_running());
+    CHECK(context.stop_requested());
+  }
+
+  TEST_CASE("io_uring_context - IOPOLL context runs until empty", "[types][io_uring][schedulers]") {
+    io_uring_context context{64, IORING_SETUP_IOPOLL};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    bool is_called = false;
+    start_detached(schedule(scheduler) | then([&] { is_called = true; }));
+    context.run_until_empty();
+    CHECK(is_called);
+    CHECK(!context.is_running());
+    CHECK(!context.stop_requested());
+  }
+
+  TEST_CASE("io_uring_context - IOPOLL context rejects timers", "[types][io_uring][schedulers]") {
+    io_uring_context context{64, IORING_SETUP_IOPOLL};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    int error = 0;
+    sync_wait(when_all(
+      schedule_after(scheduler, 1ms) | upon_error([&](std::exception_ptr eptr) {
+        try {
+          std::rethrow_exception(eptr);
+        } catch (const std::system_error& e) {
+          error = e.code().value();
+        }
+      }),
+      context.run(until::empty)));
+    CHECK(error == EINVAL);
+  }
+
+  TEST_CASE("io_uring_context - submission batch", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    std::vector<int> order;
+    std::atomic<int> n_called = 0;
+    {
+      io_uring_context::submission_batch batch{context};
+      for (int i = 0; i < 16; ++i) {
+        start_detached(schedule(scheduler) | then([&, i] {
+                         CHECK(io_thread.get_id() == std::this_thread::get_id());
+                         order.push_back(i);
+                         ++n_called;
+                       }));
+      }
+      // Nothing is submitted before the batch goes out of scope
+      std::this_thread::sleep_for(1ms);
+      CHECK(n_called == 0);
+    }
+    sync_wait(schedule(scheduler));
+    CHECK(n_called == 16);
+    std::vector<int> expected(16);
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(order == expected);
+  }
+
+  TEST_CASE(
+    "io_uring_context - submission batches from multiple threads",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    scope_guard guard{[&]() noexcept {
+      context.request_stop();
+    }};
+    constexpr int n_threads = 4;
+    constexpr int n_batches = 50;
+    constexpr int batch_size = 64;
+    std::atomic<int> n_called = 0;
+    {
+      std::vector<jthread> producers;
+      for (int t = 0; t < n_threads; ++t) {
+        producers.emplace_back([&] {
+          for (int b = 0; b < n_batches; ++b) {
+            io_uring_context::submission_batch batch{context};
+            for (int i = 0; i < batch_size; ++i) {
+              start_detached(schedule(scheduler) | then([&] { ++n_called; }));
+            }
+          }
+        });
+      }
+    }
+    while (n_called < n_threads * n_batches * batch_size) {
+      sync_wait(schedule(scheduler));
+    }
+    CHECK(n_called == n_threads * n_batches * batch_size);
+  }
+
   TEST_CASE("io_uring_context - reuse context after being used", "[types][io_uring][schedulers]") {
     io_uring_context context;
     io_uring_scheduler scheduler = context.get_scheduler();
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/linux/mapped_file.hpp>
+#include <exec/linux/safe_file_descriptor.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ex = stdexec;
+
+namespace {
+  auto make_file(std::size_t size) -> exec::safe_file_descriptor {
+    exec::safe_file_descriptor fd{::memfd_create("mapped_file", MFD_CLOEXEC)};
+    REQUIRE(fd);
+    std::vector<unsigned char> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      bytes[i] = static_cast<unsigned char>(i % 253);
+    }
+    REQUIRE(::write(fd, bytes.data(), bytes.size()) == static_cast<::ssize_t>(bytes.size()));
+    return fd;
+  }
+
+  auto sum(std::span<const std::byte> bytes) -> std::uint64_t {
+    std::uint64_t result = 0;
+    for (std::byte b: bytes) {
+      result += static_cast<unsigned char>(b);
+    }
+    return result;
+  }
+
+  TEST_CASE("mapped_file maps the whole file", "[mapped_file]") {
+    constexpr std::size_t size = 3 * 4096 + 123;
+    exec::mapped_file file{make_file(size)};
+    REQUIRE(file.size() == size);
+    REQUIRE(file.data().size() == size);
+    for (std::size_t i = 0; i < size; ++i) {
+      REQUIRE(static_cast<unsigned char>(file.data()[i]) == i % 253);
+    }
+  }
+
+  TEST_CASE("mapped_file of an empty file", "[mapped_file]") {
+    exec::mapped_file file{make_file(0)};
+    CHECK(file.size() == 0);
+    CHECK(file.data().empty());
+    CHECK(file.window_count(4096) == 0);
+    CHECK_NOTHROW(file.prefetch(0, 4096));
+  }
+
+  TEST_CASE("mapped_file throws for files that do not exist", "[mapped_file]") {
+    CHECK_THROWS_AS(exec::mapped_file{"/this/file/does/not/exist"}, std::system_error);
+  }
+
+  TEST_CASE("mapped_file windows are clamped to the end of the file", "[mapped_file]") {
+    exec::mapped_file file{make_file(10'000), {.populate = true, .sequential = true}};
+    CHECK(file.window_count(4096) == 3);
+    CHECK(file.window(0, 4096).size() == 4096);
+    CHECK(file.window(8192, 4096).size() == 10'000 - 8192);
+    CHECK(file.window(20'000, 4096).empty());
+    CHECK(file.window(4096, 4096).data() == file.data().data() + 4096);
+  }
+
+  TEST_CASE("mapped_file prefetches unaligned windows", "[mapped_file]") {
+    exec::mapped_file file{make_file(5 * 4096), {.huge_pages = true}};
+    CHECK_NOTHROW(file.prefetch(4000, 5000));
+    CHECK_NOTHROW(file.prefetch(0, file.size()));
+  }
+
+  TEST_CASE(
+    "mapped_file prefetches the next window while processing the current one",
+    "[mapped_file]") {
+    constexpr std::size_t window_size = 64 * 1024;
+    exec::mapped_file file{make_file(10 * window_size + 17)};
+    exec::static_thread_pool io_pool{1};
+    exec::static_thread_pool pool{2};
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < file.window_count(window_size); ++i) {
+      std::atomic<std::uint64_t> window_sum{0};
+      auto window = file.window(i * window_size, window_size);
+      constexpr std::size_t n_chunks = 4;
+      auto process =
+        ex::schedule(pool.get_scheduler())
+        | ex::bulk(ex::par, n_chunks, [&](std::size_t chunk) {
+            std::size_t chunk_size = (window.size() + n_chunks - 1) / n_chunks;
+            auto begin = std::min(chunk * chunk_size, window.size());
+            auto end = std::min(begin + chunk_size, window.size());
+            window_sum += sum(window.subspan(begin, end - begin));
+          });
+      auto prefetch_next =
+        file.prefetch(io_pool.get_scheduler(), (i + 1) * window_size, window_size);
+      ex::sync_wait(ex::when_all(std::move(prefetch_next), std::move(process)));
+      total += window_sum;
+    }
+    CHECK(total == sum(file.data()));
+  }
+} // namespace
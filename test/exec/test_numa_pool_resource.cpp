@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/env.hpp>
+#include <exec/numa_pool_resource.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+
+  TEST_CASE("numa_pool_resource reuses freed blocks of the same size class", "[allocators]") {
+    exec::numa_pool_resource resource{};
+    void* first = resource.allocate(40);
+    resource.deallocate(first, 40);
+    // 48 bytes are rounded up to the same 64 byte size class as 40 bytes.
+    void* second = resource.allocate(48);
+    CHECK(second == first);
+    void* third = resource.allocate(48);
+    CHECK(third != second);
+    resource.deallocate(second, 48);
+    resource.deallocate(third, 48);
+  }
+
+  TEST_CASE("numa_pool_resource forwards large and over-aligned requests", "[allocators]") {
+    exec::numa_pool_resource resource{};
+    void* large = resource.allocate(100'000);
+    void* aligned = resource.allocate(64, 256);
+    CHECK(reinterpret_cast<std::uintptr_t>(aligned) % 256 == 0);
+    resource.deallocate(aligned, 64, 256);
+    resource.deallocate(large, 100'000);
+  }
+
+  TEST_CASE("numa_pool_resource compares equal only to itself", "[allocators]") {
+    exec::numa_pool_resource resource{};
+    exec::numa_pool_resource other{};
+    CHECK(resource.is_equal(resource));
+    CHECK_FALSE(resource.is_equal(other));
+    CHECK(resource.node() == 0);
+  }
+
+  TEST_CASE("numa_pool_resource returns blocks freed on another thread", "[allocators]") {
+    exec::numa_pool_resource resource{};
+    void* block = nullptr;
+    std::thread{[&] {
+      block = resource.allocate(100);
+      resource.deallocate(block, 100);
+    }}.join();
+    // The exiting thread handed its cached blocks back to the resource.
+    void* reused = resource.allocate(100);
+    CHECK(reused == block);
+    resource.deallocate(reused, 100);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+      blocks.push_back(resource.allocate(32));
+    }
+    std::thread{[&] {
+      for (void* block: blocks) {
+        resource.deallocate(block, 32);
+      }
+    }}.join();
+    for (int i = 0; i < 1000; ++i) {
+      blocks[static_cast<std::size_t>(i)] = resource.allocate(32);
+    }
+    for (void* block: blocks) {
+      resource.deallocate(block, 32);
+    }
+  }
+
+  TEST_CASE("numa_pool_resource outlives the caches of threads that used it", "[allocators]") {
+    void* block = nullptr;
+    {
+      exec::numa_pool_resource resource{};
+      block = resource.allocate(16);
+      resource.deallocate(block, 16);
+    }
+    // The calling thread still has a cache for the destroyed resource, which must not be used.
+    exec::numa_pool_resource resources[5]{};
+    for (auto& resource: resources) {
+      void* block = resource.allocate(16);
+      resource.deallocate(block, 16);
+    }
+  }
+
+  TEST_CASE("numa_pool_resource can be injected as the allocator of a receiver", "[allocators]") {
+    exec::numa_pool_resource resource{};
+    std::pmr::polymorphic_allocator<std::byte> alloc{&resource};
+    auto sndr = ex::read_env(ex::get_allocator)
+              | exec::write_env(ex::prop{ex::get_allocator, alloc});
+    auto [result] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(result == alloc);
+  }
+
+  TEST_CASE("static_thread_pool hands out the memory resource of its nodes", "[allocators]") {
+    exec::static_thread_pool pool{2};
+    exec::numa_pool_resource& outside = pool.get_memory_resource();
+    auto [inside] =
+      ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::then([&] {
+                      return &pool.get_memory_resource();
+                    }))
+        .value();
+    CHECK(inside->node() == outside.node());
+
+    std::vector<int> values(100);
+    ex::sync_wait(
+      ex::schedule(pool.get_scheduler())
+      | ex::bulk(ex::par, values.size(), [&](std::size_t i) { values[i] = static_cast<int>(i); }));
+    CHECK(values[99] == 99);
+  }
+} // namespace
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/recycling_allocator.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  TEST_CASE("recycling_allocator reuses freed blocks of the same size class", "[allocators]") {
+    exec::recycling_allocator<std::uint64_t> alloc;
+    std::uint64_t* first = alloc.allocate(5);
+    alloc.deallocate(first, 5);
+    // 48 bytes are rounded up to the same 64 byte size class as 40 bytes.
+    std::uint64_t* second = alloc.allocate(6);
+    CHECK(second == first);
+    std::uint64_t* third = alloc.allocate(6);
+    CHECK(third != second);
+    alloc.deallocate(second, 6);
+    alloc.deallocate(third, 6);
+  }
+
+  TEST_CASE("recycling_allocator rebinds and compares equal", "[allocators]") {
+    exec::recycling_allocator<int> ints;
+    exec::recycling_allocator<double> doubles{ints};
+    CHECK(ints == doubles);
+    std::vector<int, exec::recycling_allocator<int>> values(1000, 7);
+    CHECK(values[999] == 7);
+  }
+
+  TEST_CASE("recycling_allocator blocks can be freed on another thread", "[allocators]") {
+    exec::recycling_allocator<char> alloc;
+    std::vector<char*> blocks;
+    for (int i = 0; i < 10; ++i) {
+      blocks.push_back(alloc.allocate(100));
+    }
+    std::thread{[&] {
+      for (char* block: blocks) {
+        alloc.deallocate(block, 100);
+      }
+      char* block = alloc.allocate(100);
+      CHECK(block == blocks.back());
+      alloc.deallocate(block, 100);
+    }}.join();
+  }
+
+  TEST_CASE("recycling_allocator drains threads that only allocate", "[allocators]") {
+    exec::recycling_allocator<char> alloc;
+    constexpr std::size_t n_blocks = 2 * exec::__recycling::__max_cached_blocks;
+    std::vector<char*> blocks;
+    for (std::size_t i = 0; i < n_blocks; ++i) {
+      blocks.push_back(alloc.allocate(2000));
+    }
+    // Freeing more blocks than a thread caches moves some of them to the global list.
+    std::thread{[&] {
+      for (char* block: blocks) {
+        alloc.deallocate(block, 2000);
+      }
+    }}.join();
+    // This thread refills its cache from the global list, and must free the blocks that it
+    // did not use when it exits.
+    char* block = nullptr;
+    std::thread{[&] {
+      block = alloc.allocate(2000);
+    }}.join();
+    CHECK(std::find(blocks.begin(), blocks.end(), block) != blocks.end());
+    alloc.deallocate(block, 2000);
+  }
+} // namespace
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/reduce.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "test_common/receivers.hpp"
+#include "test_common/type_helpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <list>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+
+  TEST_CASE("reduce is a sender of the initial value type", "[adaptors][reduce]") {
+    auto sndr = exec::reduce(ex::just(std::vector<int>{1, 2, 3}), 0L);
+    STATIC_REQUIRE(ex::sender<decltype(sndr)>);
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<decltype(sndr), ex::env<>>,
+        ex::completion_signatures<ex::set_error_t(std::exception_ptr), ex::set_value_t(long)>>);
+  }
+
+  TEST_CASE("reduce folds the range sequentially by default", "[adaptors][reduce]") {
+    auto [sum] = ex::sync_wait(ex::just(std::vector<int>{1, 2, 3, 4}) | exec::reduce(10)).value();
+    CHECK(sum == 20);
+
+    auto [joined] = ex::sync_wait(
+                      ex::just(std::list<std::string>{"b", "c"})
+                      | exec::reduce(std::string{"a"}, std::plus<>{}))
+                      .value();
+    CHECK(joined == "abc");
+  }
+
+  TEST_CASE("reduce of an empty range sends the initial value", "[adaptors][reduce]") {
+    auto [sum] = ex::sync_wait(ex::just(std::vector<int>{}) | exec::reduce(42)).value();
+    CHECK(sum == 42);
+  }
+
+  TEST_CASE("reduce forwards errors and stopped signals", "[adaptors][reduce]") {
+    auto op = ex::connect(
+      ex::just_error(std::make_exception_ptr(std::runtime_error{"error"}))
+        | ex::then([] { return std::vector<int>{}; }) | exec::reduce(0),
+      expect_error_receiver{});
+    ex::start(op);
+
+    auto op2 = ex::connect(
+      ex::just_stopped() | ex::then([] { return std::vector<int>{}; }) | exec::reduce(0),
+      expect_stopped_receiver{});
+    ex::start(op2);
+  }
+
+  TEST_CASE("reduce reports exceptions thrown by the operation", "[adaptors][reduce]") {
+    auto throwing = [](int, int) -> int {
+      throw std::runtime_error{"reduce"};
+    };
+    CHECK_THROWS_AS(
+      ex::sync_wait(ex::just(std::vector<int>{1, 2}) | exec::reduce(0, throwing)),
+      std::runtime_error);
+  }
+
+  TEST_CASE("reduce on static_thread_pool reduces in parallel", "[adaptors][reduce]") {
+    exec::static_thread_pool pool{4};
+    std::vector<long> values(1'000'000);
+    std::iota(values.begin(), values.end(), 0L);
+    const long expected = std::accumulate(values.begin(), values.end(), 7L);
+
+    SECTION("when the pool is the completion scheduler") {
+      auto sndr = ex::schedule(pool.get_scheduler())
+                | ex::then([&] { return std::span<const long>{values}; }) | exec::reduce(7L);
+      auto [sum] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(sum == expected);
+    }
+
+    SECTION("when the reduction is started on the pool") {
+      auto sndr = ex::starts_on(
+        pool.get_scheduler(), ex::just(std::span<const long>{values}) | exec::reduce(7L));
+      auto [sum] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(sum == expected);
+    }
+
+    SECTION("with a range too small to split") {
+      auto sndr = ex::schedule(pool.get_scheduler())
+                | ex::then([] { return std::vector<long>{1, 2, 3}; }) | exec::reduce(7L);
+      auto [sum] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(sum == 13);
+    }
+  }
+
+  TEST_CASE(
+    "reduce on static_thread_pool falls back to a sequential fold",
+    "[adaptors][reduce]") {
+    exec::static_thread_pool pool{4};
+    std::list<long> values(100'000, 1);
+    auto sndr = ex::schedule(pool.get_scheduler())
+              | ex::then([&] { return std::move(values); }) | exec::reduce(0L);
+    auto [sum] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(sum == 100'000);
+  }
+
+  TEST_CASE("reduce on static_thread_pool reports exceptions", "[adaptors][reduce]") {
+    exec::static_thread_pool pool{4};
+    std::vector<int> values(100'000, 1);
+    auto throwing = [](int lhs, int rhs) -> int {
+      if (lhs < 0 || rhs < 0) {
+        throw std::runtime_error{"reduce"};
+      }
+      return lhs + rhs;
+    };
+    values[values.size() / 2] = -1;
+    auto sndr = ex::schedule(pool.get_scheduler())
+              | ex::then([&] { return std::span<const int>{values}; })
+              | exec::reduce(0, throwing);
+    CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+  }
+} // namespace
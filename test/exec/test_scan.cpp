@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/scan.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "test_common/receivers.hpp"
+#include "test_common/type_helpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <list>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+
+  TEST_CASE("scans send the range they write to", "[adaptors][scan]") {
+    using in_place_t = decltype(exec::inclusive_scan(ex::just(std::vector<int>{})));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<in_place_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_error_t(std::exception_ptr),
+          ex::set_value_t(std::vector<int>)>>);
+
+    using out_of_place_t = decltype(exec::exclusive_scan(
+      ex::just(std::span<const int>{}, std::span<long>{}), 0L));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<out_of_place_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_error_t(std::exception_ptr),
+          ex::set_value_t(std::span<long>)>>);
+  }
+
+  TEST_CASE("inclusive_scan scans sequentially by default", "[adaptors][scan]") {
+    auto [in_place] =
+      ex::sync_wait(ex::just(std::vector<int>{1, 2, 3, 4}) | exec::inclusive_scan()).value();
+    CHECK(in_place == std::vector<int>{1, 3, 6, 10});
+
+    const std::list<std::string> words{"a", "b", "c"};
+    std::vector<std::string> joined(3);
+    auto [out] = ex::sync_wait(
+                   ex::just(words, std::span{joined})
+                   | exec::inclusive_scan(std::plus<>{}))
+                   .value();
+    CHECK(out.data() == joined.data());
+    CHECK(joined == std::vector<std::string>{"a", "ab", "abc"});
+  }
+
+  TEST_CASE("exclusive_scan scans sequentially by default", "[adaptors][scan]") {
+    auto [in_place] =
+      ex::sync_wait(ex::just(std::vector<int>{1, 2, 3, 4}) | exec::exclusive_scan(10)).value();
+    CHECK(in_place == std::vector<int>{10, 11, 13, 16});
+
+    auto [empty] = ex::sync_wait(ex::just(std::vector<int>{}) | exec::exclusive_scan(10)).value();
+    CHECK(empty.empty());
+  }
+
+  TEST_CASE("scans forward errors and stopped signals", "[adaptors][scan]") {
+    auto op = ex::connect(
+      ex::just_error(std::make_exception_ptr(std::runtime_error{"error"}))
+        | ex::then([] { return std::vector<int>{}; }) | exec::inclusive_scan(),
+      expect_error_receiver{});
+    ex::start(op);
+
+    auto op2 = ex::connect(
+      ex::just_stopped() | ex::then([] { return std::vector<int>{}; }) | exec::exclusive_scan(0),
+      expect_stopped_receiver{});
+    ex::start(op2);
+  }
+
+  TEST_CASE("scans on static_thread_pool run in parallel", "[adaptors][scan]") {
+    exec::static_thread_pool pool{4};
+    std::vector<long> values(1'000'003);
+    std::iota(values.begin(), values.end(), -500'000L);
+
+    SECTION("inclusive_scan in place") {
+      std::vector<long> expected(values.size());
+      std::inclusive_scan(values.begin(), values.end(), expected.begin());
+      auto sndr = ex::schedule(pool.get_scheduler())
+                | ex::then([&] { return std::span<long>{values}; }) | exec::inclusive_scan();
+      auto [out] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(out.data() == values.data());
+      CHECK(values == expected);
+    }
+
+    SECTION("exclusive_scan into another range") {
+      std::vector<long> expected(values.size());
+      std::exclusive_scan(values.begin(), values.end(), expected.begin(), 7L);
+      std::vector<long> output(values.size());
+      auto sndr = ex::starts_on(
+        pool.get_scheduler(),
+        ex::just(std::span<const long>{values}, std::span<long>{output})
+          | exec::exclusive_scan(7L));
+      ex::sync_wait(std::move(sndr));
+      CHECK(output == expected);
+    }
+
+    SECTION("with a non-commutative operation") {
+      std::vector<std::string> letters(10'000);
+      for (std::size_t i = 0; i < letters.size(); ++i) {
+        letters[i] = std::string(1, static_cast<char>('a' + i % 26));
+      }
+      std::vector<std::string> copy = letters;
+      auto [out] = ex::sync_wait(
+                     ex::schedule(pool.get_scheduler())
+                     | ex::then([&] { return std::move(copy); })
+                     | exec::inclusive_scan(std::plus<>{}))
+                     .value();
+      std::string running;
+      for (std::size_t i = 0; i < letters.size(); ++i) {
+        running += letters[i];
+        REQUIRE(out[i] == running);
+      }
+    }
+  }
+
+  TEST_CASE("scans on static_thread_pool report exceptions", "[adaptors][scan]") {
+    exec::static_thread_pool pool{4};
+    std::vector<int> values(100'000, 1);
+    values[values.size() / 2] = -1;
+    auto throwing = [](int lhs, int rhs) -> int {
+      if (lhs < 0 || rhs < 0) {
+        throw std::runtime_error{"scan"};
+      }
+      return lhs + rhs;
+    };
+    auto sndr = ex::schedule(pool.get_scheduler())
+              | ex::then([&] { return std::span<int>{values}; })
+              | exec::inclusive_scan(throwing);
+    CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+  }
+} // namespace
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/async_scope.hpp>
+#include <exec/env.hpp>
+#include <exec/simulation_context.hpp>
+#include <exec/when_any.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  constexpr std::uint64_t n_seeds = 200;
+
+  auto record_order(std::uint64_t seed) -> std::vector<int> {
+    exec::simulation_context ctx{seed};
+    std::vector<int> order;
+    exec::async_scope scope;
+    for (int i = 0; i < 16; ++i) {
+      scope.spawn(
+        ex::schedule(ctx.get_scheduler()) | ex::then([&order, i] { order.push_back(i); }));
+    }
+    CHECK(ctx.run() == 16);
+    ex::sync_wait(scope.on_empty());
+    return order;
+  }
+
+  TEST_CASE("simulation_context repeats the interleaving of a seed", "[simulation_context]") {
+    STATIC_REQUIRE(ex::scheduler<exec::deterministic_scheduler>);
+    CHECK(record_order(42) == record_order(42));
+    std::set<std::vector<int>> orders;
+    for (std::uint64_t seed = 0; seed < 10; ++seed) {
+      orders.insert(record_order(seed));
+    }
+    CHECK(orders.size() > 1);
+  }
+
+  TEST_CASE("simulation_context runs the work of one worker in order", "[simulation_context]") {
+    for (std::uint64_t seed = 0; seed < n_seeds; ++seed) {
+      exec::simulation_context ctx{seed, 3};
+      std::vector<int> first;
+      std::vector<int> second;
+      exec::async_scope scope;
+      for (int i = 0; i < 8; ++i) {
+        scope.spawn(ex::schedule(ctx.get_scheduler(0)) | ex::then([&, i] { first.push_back(i); }));
+        scope.spawn(ex::schedule(ctx.get_scheduler(2)) | ex::then([&, i] { second.push_back(i); }));
+      }
+      ctx.run();
+      CHECK(first == std::vector{0, 1, 2, 3, 4, 5, 6, 7});
+      CHECK(second == first);
+      CHECK(ctx.steps() == 16);
+      CHECK(ctx.empty());
+    }
+  }
+
+  TEST_CASE("simulation_context can wait for a sender", "[simulation_context]") {
+    exec::simulation_context ctx{7};
+    auto [value] = ctx.sync_wait(ex::schedule(ctx.get_scheduler()) | ex::then([] { return 42; }))
+                     .value();
+    CHECK(value == 42);
+    auto [sched] = ctx.sync_wait(ex::read_env(ex::get_scheduler)).value();
+    CHECK(sched == ctx.get_scheduler());
+    ex::inplace_stop_source stop_source;
+    stop_source.request_stop();
+    CHECK_FALSE(ctx.sync_wait(
+                     exec::write_env(
+                       ex::schedule(ctx.get_scheduler()),
+                       ex::prop{ex::get_stop_token, stop_source.get_token()}))
+                  .has_value());
+    CHECK_THROWS_AS(
+      ctx.sync_wait(
+        ex::schedule(ctx.get_scheduler()) | ex::then([] { throw std::runtime_error("error"); })),
+      std::runtime_error);
+  }
+
+  TEST_CASE("when_all completes after all of its children in any order", "[simulation_context]") {
+    for (std::uint64_t seed = 0; seed < n_seeds; ++seed) {
+      exec::simulation_context ctx{seed};
+      auto sched = ctx.get_scheduler();
+      int count = 0;
+      auto child = [&](int value) {
+        return ex::schedule(sched) | ex::then([&count, value] {
+                 ++count;
+                 return value;
+               });
+      };
+      auto [a, b, c] = ctx.sync_wait(ex::when_all(child(1), child(2), child(3))).value();
+      CHECK(a + b + c == 6);
+      CHECK(count == 3);
+    }
+  }
+
+  TEST_CASE("when_any completes with the first child to complete", "[simulation_context]") {
+    std::set<int> winners;
+    for (std::uint64_t seed = 0; seed < n_seeds; ++seed) {
+      exec::simulation_context ctx{seed};
+      auto sched = ctx.get_scheduler();
+      int completed = 0;
+      auto child = [&](int value) {
+        return ex::schedule(sched) | ex::then([&completed, value] {
+                 ++completed;
+                 return value;
+               });
+      };
+      auto [winner] = ctx.sync_wait(exec::when_any(child(1), child(2), child(3))).value();
+      winners.insert(winner);
+      // The scheduler checks for stop requests before it runs a task, so the losers never run.
+      CHECK(completed == 1);
+    }
+    CHECK(winners == std::set{1, 2, 3});
+  }
+
+  TEST_CASE("split shares one result between consumers on any worker", "[simulation_context]") {
+    for (std::uint64_t seed = 0; seed < n_seeds; ++seed) {
+      exec::simulation_context ctx{seed};
+      auto sched = ctx.get_scheduler();
+      int runs = 0;
+      auto shared = ex::schedule(sched) | ex::then([&runs] { return ++runs; }) | ex::split();
+      auto [a, b, c] = ctx.sync_wait(
+                            ex::when_all(
+                              ex::starts_on(sched, shared),
+                              ex::starts_on(sched, shared),
+                              shared))
+                         .value();
+      CHECK(runs == 1);
+      CHECK(a == 1);
+      CHECK(b == 1);
+      CHECK(c == 1);
+    }
+  }
+
+  TEST_CASE("async_scope becomes empty after all spawned work ran", "[simulation_context]") {
+    for (std::uint64_t seed = 0; seed < n_seeds; ++seed) {
+      exec::simulation_context ctx{seed};
+      auto sched = ctx.get_scheduler();
+      exec::async_scope scope;
+      int count = 0;
+      for (int i = 0; i < 10; ++i) {
+        scope.spawn(
+          ex::schedule(sched) | ex::let_value([&] {
+            // Nested work is spawned from the workers while the scope drains.
+            scope.spawn(ex::schedule(sched) | ex::then([&count] { ++count; }));
+            return ex::just();
+          }));
+      }
+      ctx.sync_wait(scope.on_empty());
+      CHECK(count == 10);
+      CHECK(ctx.empty());
+    }
+  }
+} // namespace
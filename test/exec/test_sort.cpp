@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sort.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "test_common/receivers.hpp"
+#include "test_common/type_helpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+
+  template <class Ty>
+  auto random_values(std::size_t n) -> std::vector<Ty> {
+    std::mt19937_64 gen{42};
+    std::vector<Ty> values(n);
+    for (auto& value: values) {
+      value = static_cast<Ty>(gen());
+    }
+    return values;
+  }
+
+  TEST_CASE("sort sends the sorted range", "[adaptors][sort]") {
+    using sort_t = decltype(exec::sort(ex::just(std::vector<int>{})));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<sort_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_error_t(std::exception_ptr),
+          ex::set_value_t(std::vector<int>)>>);
+  }
+
+  TEST_CASE("sort sorts sequentially by default", "[adaptors][sort]") {
+    auto [ascending] =
+      ex::sync_wait(exec::sort(ex::just(std::vector<int>{3, -1, 2, 0}))).value();
+    CHECK(ascending == std::vector<int>{-1, 0, 2, 3});
+
+    std::vector<std::string> words{"b", "c", "a"};
+    auto [descending] =
+      ex::sync_wait(ex::just(std::span{words}) | exec::sort(std::greater<>{})).value();
+    CHECK(descending.data() == words.data());
+    CHECK(words == std::vector<std::string>{"c", "b", "a"});
+  }
+
+  TEST_CASE("sort forwards errors and stopped signals", "[adaptors][sort]") {
+    auto op = ex::connect(
+      ex::just_error(std::make_exception_ptr(std::runtime_error{"error"}))
+        | ex::then([] { return std::vector<int>{}; }) | exec::sort(),
+      expect_error_receiver{});
+    ex::start(op);
+
+    auto op2 = ex::connect(
+      ex::just_stopped() | ex::then([] { return std::vector<int>{}; }) | exec::sort(),
+      expect_stopped_receiver{});
+    ex::start(op2);
+  }
+
+  TEST_CASE("sort on static_thread_pool sorts in parallel", "[adaptors][sort]") {
+    exec::static_thread_pool pool{4};
+
+    SECTION("integers in place") {
+      auto values = random_values<std::int32_t>(1'000'003);
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+      auto sndr = ex::schedule(pool.get_scheduler())
+                | ex::then([&] { return std::span<std::int32_t>{values}; }) | exec::sort();
+      auto [out] = ex::sync_wait(std::move(sndr)).value();
+      CHECK(out.data() == values.data());
+      CHECK(values == expected);
+    }
+
+    SECTION("unsigned integers by value") {
+      auto values = random_values<std::uint16_t>(300'000);
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+      auto [out] =
+        ex::sync_wait(ex::starts_on(pool.get_scheduler(), ex::just(values) | exec::sort()))
+          .value();
+      CHECK(out == expected);
+    }
+
+    SECTION("with a comparator") {
+      auto values = random_values<double>(100'000);
+      auto expected = values;
+      std::sort(expected.begin(), expected.end(), std::greater<>{});
+      auto sndr = ex::schedule(pool.get_scheduler())
+                | ex::then([&] { return std::span<double>{values}; })
+                | exec::sort(std::greater<>{});
+      ex::sync_wait(std::move(sndr));
+      CHECK(values == expected);
+    }
+
+    SECTION("strings") {
+      std::vector<std::string> values;
+      for (auto value: random_values<std::uint32_t>(20'000)) {
+        values.push_back(std::to_string(value % 1000));
+      }
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+      auto [out] =
+        ex::sync_wait(ex::starts_on(pool.get_scheduler(), ex::just(values) | exec::sort()))
+          .value();
+      CHECK(out == expected);
+    }
+  }
+
+  TEST_CASE("sort on static_thread_pool reports exceptions", "[adaptors][sort]") {
+    exec::static_thread_pool pool{4};
+    std::vector<int> values(100'000, 1);
+    values[values.size() / 3] = -1;
+    auto throwing = [](int lhs, int rhs) -> bool {
+      if (lhs < 0 || rhs < 0) {
+        throw std::runtime_error{"sort"};
+      }
+      return lhs < rhs;
+    };
+    auto sndr = ex::schedule(pool.get_scheduler())
+              | ex::then([&] { return std::span<int>{values}; }) | exec::sort(throwing);
+    CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+  }
+} // namespace
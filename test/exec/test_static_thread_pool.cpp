@@ -2,8 +2,22 @@
 #include <exec/static_thread_pool.hpp>
 #include <stdexec/execution.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
 #include <thread>
 #include <unordered_set>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
 namespace ex = stdexec;
 
 TEST_CASE(
@@ -20,3 +34,290 @@ TEST_CASE(
   }
   REQUIRE(thread_ids.size() == num_of_threads);
 }
+
+TEST_CASE(
+  "simulated_numa_policy assigns threads to nodes in the order of their CPUs",
+  "[types][static_thread_pool]") {
+  exec::simulated_numa_policy numa{
+    {{0, 1}, {2, 3, 4}}
+  };
+  CHECK(numa.num_nodes() == 2);
+  CHECK(numa.num_cpus(0) == 2);
+  CHECK(numa.num_cpus(1) == 3);
+  CHECK(numa.num_cpus(2) == 0);
+  int nodes[] = {0, 0, 1, 1, 1, 0, 0, 1};
+  for (std::size_t i = 0; i < std::size(nodes); ++i) {
+    CHECK(numa.thread_index_to_node(i) == nodes[i]);
+  }
+
+  exec::nodemask mask{};
+  mask.set(1);
+  CHECK_FALSE(mask[0]);
+  CHECK(mask[1]);
+  CHECK(exec::nodemask::any()[1]);
+}
+
+TEST_CASE(
+  "static_thread_pool runs constrained work on a simulated NUMA topology",
+  "[types][static_thread_pool]") {
+  exec::simulated_numa_policy numa{2, 2};
+  exec::static_thread_pool pool{4, exec::bwos_params{}, numa};
+  for (std::size_t node = 0; node < 2; ++node) {
+    exec::nodemask mask{};
+    mask.set(node);
+    auto [value] =
+      ex::sync_wait(ex::schedule(pool.get_constrained_scheduler(&mask)) | ex::then([] {
+                      return 42;
+                    }))
+        .value();
+    CHECK(value == 42);
+  }
+}
+
+TEST_CASE(
+  "static_thread_pool reports steals across simulated NUMA nodes",
+  "[types][static_thread_pool]") {
+  exec::simulated_numa_policy numa{2, 1, std::chrono::microseconds{1}};
+  exec::static_thread_pool pool{2, exec::bwos_params{}, numa};
+  constexpr int num_tasks = 100;
+  std::atomic<int> done{0};
+  std::atomic<bool> stolen{false};
+  std::atomic<bool> pushed{false};
+  // Keep the thread of the other node awake, so that it looks for work once it is done.
+  ex::start_detached(ex::schedule(pool.get_scheduler_on_thread(1)) | ex::then([&] {
+                       while (!pushed) {
+                         std::this_thread::yield();
+                       }
+                     }));
+  ex::sync_wait(ex::schedule(pool.get_scheduler_on_thread(0)) | ex::then([&] {
+                  const std::thread::id owner = std::this_thread::get_id();
+                  // Scheduled from a thread of the pool, these go to its local queue.
+                  for (int i = 0; i < num_tasks; ++i) {
+                    ex::start_detached(ex::schedule(pool.get_scheduler()) | ex::then([&, owner] {
+                                         if (std::this_thread::get_id() != owner) {
+                                           stolen = true;
+                                         }
+                                         ++done;
+                                       }));
+                  }
+                  pushed = true;
+                  // Keep the owner busy until the thread of the other node took over some work.
+                  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+                  while (!stolen && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                  }
+                }));
+  while (done < num_tasks) {
+    std::this_thread::yield();
+  }
+  CHECK(stolen);
+  CHECK(numa.remote_accesses() > 0);
+}
+
+namespace {
+  //! Assigns the threads of a pool to two nodes alternately.
+  struct interleaved_numa_policy {
+    [[nodiscard]]
+    auto num_nodes() const noexcept -> std::size_t {
+      return 2;
+    }
+
+    [[nodiscard]]
+    auto num_cpus(int) const noexcept -> std::size_t {
+      return 2;
+    }
+
+    auto bind_to_node(int) const noexcept -> int {
+      return 0;
+    }
+
+    [[nodiscard]]
+    auto thread_index_to_node(std::size_t index) const noexcept -> int {
+      return static_cast<int>(index % 2);
+    }
+  };
+} // namespace
+
+TEST_CASE(
+  "static_thread_pool partitions bulk work by NUMA node",
+  "[types][static_thread_pool]") {
+  exec::static_thread_pool pool{5, exec::bwos_params{}, interleaved_numa_policy{}};
+  // Threads 0, 2 and 4 are on node 0, threads 1 and 3 on node 1.
+  CHECK(pool.numa_node_share(10, 0) == std::pair{0, 6});
+  CHECK(pool.numa_node_share(10, 1) == std::pair{6, 10});
+  CHECK(pool.bulk_share(10, 0) == std::pair{0, 2});
+  CHECK(pool.bulk_share(10, 2) == std::pair{2, 4});
+  CHECK(pool.bulk_share(10, 4) == std::pair{4, 6});
+  CHECK(pool.bulk_share(10, 1) == std::pair{6, 8});
+  CHECK(pool.bulk_share(10, 3) == std::pair{8, 10});
+  CHECK(pool.numa_node_share(std::size_t{1} << 62, 1).second == std::size_t{1} << 62);
+
+  std::vector<int> touched(1000);
+  std::vector<int> visits(1000);
+  std::atomic<int> chunks{0};
+  ex::sync_wait(exec::numa_first_touch(pool.get_scheduler(), 1000, [&](int begin, int end) {
+    ++chunks;
+    for (int i = begin; i < end; ++i) {
+      touched[static_cast<std::size_t>(i)] = i;
+    }
+  }));
+  CHECK(chunks == 5);
+  ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par, 1000, [&](int i) {
+                  visits[static_cast<std::size_t>(i)] += 1;
+                }));
+  std::vector<int> indices(1000);
+  std::iota(indices.begin(), indices.end(), 0);
+  CHECK(touched == indices);
+  CHECK(visits == std::vector<int>(1000, 1));
+}
+
+TEST_CASE("cpu_topology reads the layout of sysfs", "[types][static_thread_pool]") {
+  CHECK(exec::cpu_topology::parse_cpu_list("0-3,8,10-11\n") == std::vector{0, 1, 2, 3, 8, 10, 11});
+  CHECK(exec::cpu_topology::parse_cpu_list("").empty());
+
+  namespace fs = std::filesystem;
+  const fs::path root = fs::temp_directory_path()
+                      / ("stdexec_cpu_topology_" + std::to_string(std::random_device{}()));
+  auto write = [&](const fs::path& path, const char* content) {
+    fs::create_directories((root / path).parent_path());
+    std::ofstream{root / path} << content;
+  };
+  // Two cores with two hardware threads each that share an L3 cache, on two nodes.
+  write("online", "0-3\n");
+  for (int cpu = 0; cpu < 4; ++cpu) {
+    const std::string dir = "cpu" + std::to_string(cpu);
+    write(dir + "/topology/thread_siblings_list", cpu < 2 ? "0-1\n" : "2-3\n");
+    write(dir + "/cache/index0/level", "1\n");
+    write(dir + "/cache/index0/shared_cpu_list", cpu < 2 ? "0-1\n" : "2-3\n");
+    write(dir + "/cache/index1/level", "3\n");
+    write(dir + "/cache/index1/shared_cpu_list", "0-3\n");
+    fs::create_directories(root / dir / (cpu < 2 ? "node0" : "node1"));
+  }
+  exec::cpu_topology topology = exec::cpu_topology::from_sysfs(root);
+  fs::remove_all(root);
+
+  REQUIRE(topology.cpus().size() == 4);
+  CHECK(topology.cpus()[1] == exec::cpu_info{.cpu = 1, .core = 0, .l3 = 0, .node = 0});
+  CHECK(topology.cpus()[3] == exec::cpu_info{.cpu = 3, .core = 2, .l3 = 0, .node = 1});
+  CHECK(topology.cpus_of_node(1).size() == 2);
+  CHECK(topology.cpus_of_node(7).size() == 4);
+  CHECK(exec::cpu_steal_level(topology.cpus()[0], topology.cpus()[1]) == exec::steal_level::smt);
+  CHECK(exec::cpu_steal_level(topology.cpus()[0], topology.cpus()[2]) == exec::steal_level::cache);
+  CHECK(exec::cpu_topology::from_sysfs(root).empty());
+}
+
+TEST_CASE("threads are sorted into rings of victims", "[types][static_thread_pool]") {
+  using rings_t = exec::__topology::__steal_rings_t;
+  using ring_t = std::vector<std::uint32_t>;
+  auto skipped = [](const rings_t& rings) {
+    std::vector<bool> result;
+    for (std::size_t level = 0; level < exec::steal_level_count; ++level) {
+      result.push_back(exec::__topology::__skips_steal_ring(rings, level));
+    }
+    return result;
+  };
+
+  SECTION("one node with two L3 caches of two cores with two hardware threads each") {
+    std::vector<exec::cpu_info> cpus;
+    for (int cpu = 0; cpu < 8; ++cpu) {
+      cpus.push_back({.cpu = cpu, .core = cpu / 2 * 2, .l3 = cpu / 4 * 4, .node = 0});
+    }
+    rings_t rings = exec::__topology::__steal_rings(cpus, 5);
+    CHECK(rings[0] == ring_t{4});
+    CHECK(rings[1] == ring_t{4, 6, 7});
+    CHECK(rings[2] == ring_t{0, 1, 2, 3, 4, 6, 7});
+    CHECK(rings[3] == ring_t{0, 1, 2, 3, 4, 6, 7});
+    CHECK(skipped(rings) == std::vector<bool>{false, false, false, false});
+  }
+
+  SECTION("two nodes with one L3 cache each") {
+    std::vector<exec::cpu_info> cpus;
+    for (int cpu = 0; cpu < 8; ++cpu) {
+      cpus.push_back({.cpu = cpu, .core = cpu / 2 * 2, .l3 = cpu / 4 * 4, .node = cpu / 4});
+    }
+    rings_t rings = exec::__topology::__steal_rings(cpus, 0);
+    CHECK(rings[0] == ring_t{1});
+    CHECK(rings[1] == ring_t{1, 2, 3});
+    CHECK(rings[2] == ring_t{1, 2, 3});
+    CHECK(rings[3] == ring_t{1, 2, 3, 4, 5, 6, 7});
+    // The cache ring contains the same threads as the node ring, which is tried next.
+    CHECK(skipped(rings) == std::vector<bool>{false, true, false, false});
+  }
+
+  SECTION("an unknown topology only distinguishes NUMA nodes") {
+    std::vector<exec::cpu_info> cpus;
+    for (int thread = 0; thread < 4; ++thread) {
+      cpus.push_back({.cpu = -1, .core = -1, .l3 = -1, .node = thread % 2});
+    }
+    rings_t rings = exec::__topology::__steal_rings(cpus, 1);
+    CHECK(rings[0].empty());
+    CHECK(rings[1].empty());
+    CHECK(rings[2] == ring_t{3});
+    CHECK(rings[3] == ring_t{0, 2, 3});
+    CHECK(skipped(rings) == std::vector<bool>{true, true, false, false});
+  }
+
+  SECTION("a single thread has no victims") {
+    std::vector<exec::cpu_info> cpus{{.cpu = 0, .core = 0, .l3 = 0, .node = 0}};
+    CHECK(skipped(exec::__topology::__steal_rings(cpus, 0))
+          == std::vector<bool>{true, true, true, true});
+  }
+}
+
+TEST_CASE(
+  "static_thread_pool steals along the rings of a CPU topology",
+  "[types][static_thread_pool]") {
+  // Four cores with two hardware threads each; two L3 caches of two cores each.
+  std::vector<exec::cpu_info> cpus;
+  for (int cpu = 0; cpu < 8; ++cpu) {
+    cpus.push_back({.cpu = cpu, .core = cpu / 2 * 2, .l3 = cpu / 4 * 4, .node = 0});
+  }
+  exec::topology_params topology{
+    .topology = exec::cpu_topology{cpus},
+    .steal_attempts = {2, 4, 8, 16},
+  };
+  exec::static_thread_pool pool{8, exec::bwos_params{}, exec::no_numa_policy{}, topology};
+
+  // Spawn work from within the pool, so that idle threads have to steal it.
+  std::atomic<int> done{0};
+  ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::then([&] {
+                  for (int i = 0; i < 1000; ++i) {
+                    ex::start_detached(
+                      ex::schedule(pool.get_scheduler()) | ex::then([&] { ++done; }));
+                  }
+                }));
+  while (done < 1000) {
+    std::this_thread::yield();
+  }
+  CHECK(done == 1000);
+}
+
+#if defined(__linux__)
+TEST_CASE("static_thread_pool can pin its threads to CPUs", "[types][static_thread_pool]") {
+  exec::cpu_topology topology = exec::cpu_topology::from_sysfs();
+  ::cpu_set_t allowed;
+  if (topology.empty() || ::sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return;
+  }
+  const std::vector<exec::cpu_info> cpus = topology.cpus_of_node(0);
+  for (const exec::cpu_info& info: cpus) {
+    if (!CPU_ISSET(static_cast<std::size_t>(info.cpu), &allowed)) {
+      return;
+    }
+  }
+  const std::size_t n_threads = cpus.size();
+  exec::static_thread_pool pool{
+    static_cast<std::uint32_t>(n_threads),
+    exec::bwos_params{},
+    exec::no_numa_policy{},
+    exec::topology_params{.topology = topology, .pin_threads = true}
+  };
+  for (std::size_t i = 0; i < n_threads; ++i) {
+    auto [cpu] = ex::sync_wait(ex::schedule(pool.get_scheduler_on_thread(i)) | ex::then([] {
+                                 return ::sched_getcpu();
+                               }))
+                   .value();
+    CHECK(cpu == cpus[i].cpu);
+  }
+}
+#endif
@@ -24,6 +24,7 @@
 
 #  include <catch2/catch.hpp>
 
+#  include <atomic>
 #  include <thread>
 
 using namespace exec;
@@ -223,6 +224,78 @@ namespace {
     sync_wait(std::move(t));
   }
 
+  using single_thread_scheduler = decltype(std::declval<single_thread_context&>().get_scheduler());
+
+  struct counting_sender;
+
+  //! Wraps the scheduler of a single_thread_context and counts the calls to schedule.
+  struct counting_scheduler {
+    auto schedule() const noexcept -> counting_sender;
+
+    auto operator==(const counting_scheduler&) const noexcept -> bool = default;
+
+    single_thread_scheduler inner_;
+    std::atomic<int>* count_;
+  };
+
+  struct counting_sender {
+    using sender_concept = stdexec::sender_t;
+    using inner_t = schedule_result_t<single_thread_scheduler>;
+
+    struct attrs {
+      template <class Tag>
+      auto query(get_completion_scheduler_t<Tag>) const noexcept -> counting_scheduler {
+        return sched_;
+      }
+
+      counting_scheduler sched_;
+    };
+
+    template <class Env>
+    auto get_completion_signatures(Env&&) const -> completion_signatures_of_t<inner_t, Env> {
+      return {};
+    }
+
+    template <receiver Receiver>
+    auto connect(Receiver rcvr) && -> connect_result_t<inner_t, Receiver> {
+      return stdexec::connect(std::move(inner_), std::move(rcvr));
+    }
+
+    auto get_env() const noexcept -> attrs {
+      return {sched_};
+    }
+
+    inner_t inner_;
+    counting_scheduler sched_;
+  };
+
+  auto counting_scheduler::schedule() const noexcept -> counting_sender {
+    ++*count_;
+    return {stdexec::schedule(inner_), *this};
+  }
+
+  auto test_skips_redundant_reschedules(counting_scheduler sched, std::atomic<int>& count)
+    -> task<void> {
+    co_await reschedule_coroutine_on(sched);
+    CHECK(count == 1);
+    for (int i = 0; i < 10; ++i) {
+      co_await schedule(sched);
+    }
+    CHECK(count == 11); // The schedule senders complete on the scheduler of the task
+    co_await (schedule(sched) | then([] { }));
+    CHECK(count == 12); // then forwards the completion scheduler
+    co_await just();
+    CHECK(count == 13); // just completes inline, so the task has to transition back
+  } // Reschedules back to the scheduler of sync_wait
+
+  TEST_CASE("task skips the reschedule if a sender completes on its scheduler", "[task]") {
+    single_thread_context context;
+    std::atomic<int> count{0};
+    counting_scheduler sched{context.get_scheduler(), &count};
+    sync_wait(test_skips_redundant_reschedules(sched, count));
+    CHECK(count == 13);
+  }
+
   auto check_stop_possible() -> exec::task<void> {
     auto stop_token = co_await stdexec::get_stop_token();
     CHECK(stop_token.stop_possible());
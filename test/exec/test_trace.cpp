@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/static_thread_pool.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+#include <exec/trace.hpp>
+#include <stdexec/execution.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+  auto count_events(
+    const std::vector<exec::trace_record>& records,
+    exec::trace_event event,
+    const char* name) -> std::size_t {
+    return static_cast<std::size_t>(std::count_if(records.begin(), records.end(), [&](auto& r) {
+      return r.event == event && std::strcmp(r.name, name) == 0;
+    }));
+  }
+
+  TEST_CASE("nothing is recorded while tracing is stopped", "[trace]") {
+    exec::start_tracing();
+    exec::stop_tracing();
+    CHECK_FALSE(exec::tracing_enabled());
+    exec::static_thread_pool pool{2};
+    ex::sync_wait(ex::schedule(pool.get_scheduler()) | exec::trace("stopped"));
+    CHECK(exec::collect_trace().empty());
+  }
+
+  TEST_CASE("static_thread_pool records its scheduling events", "[trace]") {
+    exec::static_thread_pool pool{2};
+    exec::start_tracing();
+    CHECK(exec::tracing_enabled());
+    for (int i = 0; i < 10; ++i) {
+      ex::sync_wait(ex::schedule(pool.get_scheduler()));
+    }
+    ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par, 2, [](int) { }));
+    exec::stop_tracing();
+    auto records = exec::collect_trace();
+    CHECK(count_events(records, exec::trace_event::enqueue, "static_thread_pool") >= 12);
+    CHECK(count_events(records, exec::trace_event::dequeue, "static_thread_pool") >= 12);
+    CHECK(std::is_sorted(records.begin(), records.end(), [](auto& lhs, auto& rhs) {
+      return lhs.time_ns < rhs.time_ns;
+    }));
+  }
+
+  TEST_CASE("trace records a span around a sender", "[trace]") {
+    exec::static_thread_pool pool{1};
+    exec::start_tracing();
+    auto [value] = ex::sync_wait(
+                     ex::schedule(pool.get_scheduler()) | ex::then([] { return 42; })
+                     | exec::trace("answer"))
+                     .value();
+    CHECK(value == 42);
+    ex::sync_wait(exec::trace("just", ex::just()));
+    exec::stop_tracing();
+    auto records = exec::collect_trace();
+    CHECK(count_events(records, exec::trace_event::span_begin, "answer") == 1);
+    CHECK(count_events(records, exec::trace_event::span_end, "answer") == 1);
+    CHECK(count_events(records, exec::trace_event::span_begin, "just") == 1);
+    std::vector<std::uint64_t> ids;
+    for (auto& record: records) {
+      if (record.event == exec::trace_event::span_begin) {
+        ids.push_back(record.arg);
+      } else if (record.event == exec::trace_event::span_end) {
+        CHECK(std::find(ids.begin(), ids.end(), record.arg) != ids.end());
+      }
+    }
+  }
+
+  TEST_CASE("timed_thread_context records fired timers", "[trace]") {
+    exec::timed_thread_context context;
+    exec::start_tracing();
+    ex::sync_wait(exec::schedule_after(context.get_scheduler(), std::chrono::milliseconds(1)));
+    exec::stop_tracing();
+    auto records = exec::collect_trace();
+    CHECK(count_events(records, exec::trace_event::timer, "timed_thread_context") == 1);
+  }
+
+  TEST_CASE("a full buffer keeps the latest events", "[trace]") {
+    exec::start_tracing(8);
+    std::thread{[] {
+      for (std::uint64_t i = 0; i < 100; ++i) {
+        exec::__trace::__record(exec::trace_event::enqueue, "test", i);
+      }
+    }}.join();
+    exec::stop_tracing();
+    std::vector<std::uint64_t> args;
+    for (auto& record: exec::collect_trace()) {
+      if (std::strcmp(record.name, "test") == 0) {
+        args.push_back(record.arg);
+      }
+    }
+    CHECK(args == std::vector<std::uint64_t>{92, 93, 94, 95, 96, 97, 98, 99});
+  }
+
+  TEST_CASE("the buffers of exited threads are reused", "[trace]") {
+    constexpr std::size_t max_idle = exec::__trace::__registry::__max_idle_buffers;
+    exec::__trace::__registry& registry = exec::__trace::__get_registry();
+    exec::start_tracing(64);
+    const std::size_t before = registry.__buffer_count();
+    auto record = [] {
+      exec::__trace::__record(exec::trace_event::enqueue, "short-lived", 0);
+    };
+    // Threads that run one after the other share a buffer.
+    for (int i = 0; i < 100; ++i) {
+      std::thread{record}.join();
+    }
+    CHECK(registry.__buffer_count() <= before + 1);
+    // Of many threads that run at once, only some buffers are kept after they exit.
+    for (int round = 0; round < 4; ++round) {
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < 2 * max_idle; ++i) {
+        threads.emplace_back(record);
+      }
+      for (auto& thread: threads) {
+        thread.join();
+      }
+      CHECK(registry.__buffer_count() <= before + max_idle);
+    }
+    exec::stop_tracing();
+    auto records = exec::collect_trace();
+    CHECK(count_events(records, exec::trace_event::enqueue, "short-lived") > 0);
+    // Clearing the trace frees the buffers of exited threads.
+    exec::clear_trace();
+    CHECK(registry.__buffer_count() <= before);
+    CHECK(exec::collect_trace().empty());
+  }
+
+  TEST_CASE("write_chrome_trace writes the trace event format", "[trace]") {
+    std::vector<exec::trace_record> records{
+      {.time_ns = 1000,
+       .name = "static_thread_pool",
+       .arg = 3,
+       .thread = 1,
+       .event = exec::trace_event::steal},
+      {.time_ns = 2500,
+       .name = "static_thread_pool",
+       .arg = 1,
+       .thread = 1,
+       .event = exec::trace_event::sleep},
+      {.time_ns = 3000,
+       .name = "a \"quoted\" span",
+       .arg = 7,
+       .thread = 0,
+       .event = exec::trace_event::span_begin},
+    };
+    std::ostringstream out;
+    exec::write_chrome_trace(out, records);
+    std::string json = out.str();
+    CHECK(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    CHECK(
+      json.find(
+        "{\"name\":\"steal\",\"cat\":\"static_thread_pool\",\"ph\":\"i\",\"s\":\"t\","
+        "\"args\":{\"arg\":3},\"ts\":0.000,\"pid\":1,\"tid\":1}")
+      != std::string::npos);
+    CHECK(json.find("\"name\":\"sleep\",\"cat\":\"static_thread_pool\",\"ph\":\"B\",\"ts\":1.500")
+          != std::string::npos);
+    CHECK(
+      json.find("\"name\":\"a \\\"quoted\\\" span\",\"cat\":\"sender\",\"ph\":\"b\",\"id\":7")
+      != std::string::npos);
+    CHECK(json.ends_with("\n]}\n"));
+  }
+} // namespace
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/when_all_range.hpp"
+#include "exec/env.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "test_common/allocators.hpp"
+#include "test_common/receivers.hpp"
+#include "test_common/senders.hpp"
+#include "test_common/type_helpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = stdexec;
+
+namespace {
+
+  // Completes when stop is requested, unless it is the failing shard, which throws.
+  auto shard(int i, int failing) {
+    return completes_if{i == failing} | ex::then([i, failing] {
+             if (i == failing) {
+               throw std::runtime_error{"shard"};
+             }
+             return i;
+           });
+  }
+
+  auto square_on(exec::static_thread_pool::scheduler sched, int i) {
+    return ex::starts_on(sched, ex::just(i) | ex::then([](int i) { return i * i; }));
+  }
+
+  TEST_CASE("when_all_range sends a vector of the values", "[adaptors][when_all_range]") {
+    using values_t = decltype(exec::when_all_range(std::vector{ex::just(1)}));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<values_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_value_t(std::vector<int>),
+          ex::set_error_t(std::exception_ptr),
+          ex::set_stopped_t()>>);
+
+    using void_t = decltype(exec::when_all_range(std::vector{ex::just()}));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<void_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_value_t(),
+          ex::set_error_t(std::exception_ptr),
+          ex::set_stopped_t()>>);
+
+    using fold_t = decltype(exec::when_all_range(
+      std::vector{ex::just(1) | ex::then([](int) -> int { throw 0; })}, 0L, std::plus<>{}));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<fold_t, ex::env<>>,
+        ex::completion_signatures<
+          ex::set_value_t(long),
+          ex::set_error_t(std::exception_ptr),
+          ex::set_stopped_t()>>);
+  }
+
+  TEST_CASE("when_all_range keeps the order of the range", "[adaptors][when_all_range]") {
+    std::vector<decltype(ex::just(std::string{}))> senders;
+    for (int i = 0; i < 10; ++i) {
+      senders.push_back(ex::just(std::to_string(i)));
+    }
+
+    auto [copied] = ex::sync_wait(exec::when_all_range(senders)).value();
+    CHECK(copied == std::vector<std::string>{"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"});
+
+    auto [folded] =
+      ex::sync_wait(exec::when_all_range(std::move(senders), std::string{">"}, std::plus<>{}))
+        .value();
+    CHECK(folded == ">0123456789");
+  }
+
+  TEST_CASE("when_all_range of an empty range completes inline", "[adaptors][when_all_range]") {
+    std::vector<decltype(ex::just(1))> senders;
+    auto op = ex::connect(exec::when_all_range(senders), expect_value_receiver{std::vector<int>{}});
+    ex::start(op);
+
+    auto op2 =
+      ex::connect(exec::when_all_range(senders, 42, std::plus<>{}), expect_value_receiver{42});
+    ex::start(op2);
+  }
+
+  TEST_CASE("when_all_range accepts views of senders", "[adaptors][when_all_range]") {
+    int counter = 0;
+    auto increments = std::views::iota(0, 100)
+                    | std::views::transform([&counter](int) {
+                        return ex::just() | ex::then([&counter] { ++counter; });
+                      });
+    ex::sync_wait(exec::when_all_range(increments));
+    CHECK(counter == 100);
+  }
+
+  TEST_CASE("when_all_range stops the other senders on error", "[adaptors][when_all_range]") {
+    auto make_senders = [](int failing) {
+      std::vector<decltype(shard(0, 0))> senders;
+      for (int i = 0; i < 5; ++i) {
+        senders.push_back(shard(i, failing));
+      }
+      return senders;
+    };
+
+    SECTION("the first sender fails") {
+      auto op = ex::connect(exec::when_all_range(make_senders(0)), expect_error_receiver{});
+      ex::start(op);
+    }
+
+    SECTION("the last sender fails") {
+      auto op = ex::connect(exec::when_all_range(make_senders(4)), expect_error_receiver{});
+      ex::start(op);
+    }
+  }
+
+  TEST_CASE("when_all_range forwards a stop request", "[adaptors][when_all_range]") {
+    ex::inplace_stop_source stop_source;
+    std::vector<completes_if> senders(3, completes_if{false});
+    auto op = ex::connect(
+      exec::when_all_range(senders),
+      expect_stopped_receiver{ex::prop{ex::get_stop_token, stop_source.get_token()}});
+    ex::start(op);
+    stop_source.request_stop();
+  }
+
+  TEST_CASE(
+    "when_all_range allocates the operations with the allocator of the environment",
+    "[adaptors][when_all_range]") {
+    counting_allocator<std::byte>::allocations = 0;
+    counting_allocator<std::byte>::deallocations = 0;
+    std::vector senders(8, ex::just(2));
+    auto sndr = exec::write_env(
+      exec::when_all_range(senders, 1, std::multiplies<>{}),
+      ex::prop{ex::get_allocator, counting_allocator<std::byte>{}});
+    auto [product] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(product == 256);
+    CHECK(counting_allocator<std::byte>::allocations == 1);
+    CHECK(counting_allocator<std::byte>::deallocations == 1);
+  }
+
+  TEST_CASE("when_all_range runs the senders concurrently", "[adaptors][when_all_range]") {
+    exec::static_thread_pool pool{4};
+    auto sched = pool.get_scheduler();
+    std::vector<decltype(square_on(sched, 0))> senders;
+    for (int i = 0; i < 512; ++i) {
+      senders.push_back(square_on(sched, i));
+    }
+    auto [sum] = ex::sync_wait(exec::when_all_range(senders, 0, std::plus<>{})).value();
+    CHECK(sum == 511 * 512 * 1023 / 6);
+
+    auto [values] = ex::sync_wait(exec::when_all_range(std::move(senders))).value();
+    REQUIRE(values.size() == 512);
+    for (int i = 0; i < 512; ++i) {
+      CHECK(values[static_cast<std::size_t>(i)] == i * i);
+    }
+  }
+} // namespace
@@ -16,7 +16,9 @@
 
 #include <exec/when_any.hpp>
 #include <exec/single_thread_context.hpp>
+#include <array>
 #include <numbers>
+#include <stdexcept>
 #include <test_common/schedulers.hpp>
 #include <test_common/receivers.hpp>
 #include <test_common/senders.hpp>
@@ -221,4 +223,78 @@ namespace {
   TEST_CASE("when_any - with duplicate completions", "[adaptors][when_any]") {
     REQUIRE_THROWS(stdexec::sync_wait(exec::when_any(dup_sender{})));
   }
+
+  TEST_CASE("when_any_value ignores errors and stopped signals", "[adaptors][when_any]") {
+    ex::sender auto snd =
+      exec::when_any_value(ex::just_error(-1), ex::just_stopped(), ex::just(42));
+    wait_for_value(std::move(snd), 42);
+
+    ex::sender auto snd2 = exec::when_any_value(
+      completes_if{false} | ex::then([] { return 1; }), ex::just_error(-1), ex::just(42));
+    wait_for_value(std::move(snd2), 42);
+  }
+
+  TEST_CASE(
+    "when_any_value forwards the first failure if no value arrives",
+    "[adaptors][when_any]") {
+    auto op = ex::connect(
+      exec::when_any_value(ex::just_error(-1), ex::just_stopped()), expect_error_receiver{-1});
+    ex::start(op);
+
+    auto op2 = ex::connect(
+      exec::when_any_value(ex::just_stopped(), ex::just_error(-1)) | ex::upon_error([](int) { }),
+      expect_stopped_receiver{});
+    ex::start(op2);
+  }
+
+  auto failing_replica() {
+    return ex::just() | ex::then([]() -> int { throw std::runtime_error{"replica failed"}; });
+  }
+
+  TEST_CASE("when_any_n sends the first values in arrival order", "[adaptors][when_any]") {
+    impulse_scheduler sch1;
+    impulse_scheduler sch2;
+    impulse_scheduler sch3;
+    ex::sender auto snd = exec::when_any_n<2>(
+      ex::starts_on(sch1, ex::just(1)),
+      ex::starts_on(sch2, ex::just(2)),
+      ex::starts_on(sch3, ex::just(3)));
+    STATIC_REQUIRE(
+      set_equivalent<
+        ex::completion_signatures_of_t<decltype(snd), ex::env<>>,
+        ex::completion_signatures<
+          ex::set_value_t(std::array<int, 2>),
+          ex::set_error_t(std::exception_ptr),
+          ex::set_stopped_t()>>);
+
+    auto op = ex::connect(std::move(snd), expect_value_receiver{std::array<int, 2>{3, 1}});
+    ex::start(op);
+    sch3.start_next();
+    sch1.start_next();
+    // Both values have arrived, and the sender on sch2 has been asked to stop. Running it only
+    // delivers its stopped completion.
+    sch2.start_next();
+  }
+
+  TEST_CASE("when_any_n stops the other senders", "[adaptors][when_any]") {
+    ex::sender auto snd = exec::when_any_n<2>(
+      ex::just(1),
+      completes_if{false} | ex::then([] { return 2; }),
+      failing_replica(),
+      ex::just(3));
+    auto [values] = ex::sync_wait(std::move(snd)).value();
+    CHECK(values == std::array<int, 2>{1, 3});
+  }
+
+  TEST_CASE(
+    "when_any_n fails as soon as too few values can arrive",
+    "[adaptors][when_any]") {
+    ex::sender auto snd = exec::when_any_n<2>(
+      failing_replica(), completes_if{false} | ex::then([] { return 1; }), failing_replica());
+    CHECK_THROWS_AS(ex::sync_wait(std::move(snd)), std::runtime_error);
+
+    ex::sender auto snd2 = exec::when_any_n<3>(
+      ex::just(1), failing_replica(), completes_if{false} | ex::then([] { return 2; }));
+    CHECK_THROWS_AS(ex::sync_wait(std::move(snd2)), std::runtime_error);
+  }
 } // namespace
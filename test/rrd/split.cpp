@@ -2,6 +2,7 @@
 #include "../../relacy/relacy_cli.hpp"
 
 #include <stdexec/execution.hpp>
+#include <exec/env.hpp>
 #include <exec/static_thread_pool.hpp>
 
 using rl::nvar;
@@ -23,10 +24,58 @@ struct split_bug : rl::test_suite<split_bug, 1> {
   }
 };
 
+// One consumer is added to the waiters list from a pool thread while the shared operation
+// completes on the other, and another is added from this thread, possibly after completion.
+struct split_consumers_race_completion : rl::test_suite<split_consumers_race_completion, 1> {
+  static size_t const dynamic_thread_count = 3;
+
+  void thread(unsigned) {
+    exec::static_thread_pool pool{2};
+    ex::scheduler auto sch = pool.get_scheduler();
+    auto split = ex::schedule(sch) //
+               | ex::then([] { return 42; }) | ex::split();
+
+    auto [lhs, rhs] = ex::sync_wait(ex::when_all(ex::starts_on(sch, split), split)).value();
+    RL_ASSERT(lhs == 42);
+    RL_ASSERT(rhs == 42);
+  }
+};
+
+// A stop request for one consumer races with that consumer being added to the waiters list and
+// with the completion of the shared operation. Every consumer must complete exactly once.
+struct split_stop_races_completion : rl::test_suite<split_stop_races_completion, 1> {
+  static size_t const dynamic_thread_count = 3;
+
+  void thread(unsigned) {
+    exec::static_thread_pool pool{2};
+    ex::scheduler auto sch = pool.get_scheduler();
+    auto split = ex::schedule(sch) //
+               | ex::then([] { return 42; }) | ex::split();
+
+    ex::inplace_stop_source stop_source;
+    auto stoppable = exec::write_env(
+                       split | ex::then([](int val) { return val == 42; }),
+                       ex::prop{ex::get_stop_token, stop_source.get_token()})
+                   | ex::upon_stopped([] { return true; });
+    auto request_stop = ex::then([&] { stop_source.request_stop(); });
+
+    auto [stopped_ok, ok] = ex::sync_wait(
+                              ex::when_all(
+                                ex::starts_on(sch, std::move(stoppable)),
+                                split | ex::then([](int val) { return val == 42; }),
+                                ex::schedule(sch) | std::move(request_stop)))
+                              .value();
+    RL_ASSERT(stopped_ok);
+    RL_ASSERT(ok);
+  }
+};
+
 auto main() -> int {
   rl::test_params p;
   p.iteration_count = 50000;
   p.execution_depth_limit = 10000;
   rl::simulate<split_bug>(p);
+  rl::simulate<split_consumers_race_completion>(p);
+  rl::simulate<split_stop_races_completion>(p);
   return 0;
 }
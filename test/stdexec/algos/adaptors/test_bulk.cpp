@@ -344,6 +344,26 @@ namespace {
     (void) snd4;
   }
 
+  TEST_CASE("bulk with unsequenced policies visits every index once", "[adaptors][bulk]") {
+    constexpr int n = 1027;
+    std::vector<float> values(n, 1.0f);
+    auto scale = [](int i, std::vector<float>& vs) noexcept { vs[i] *= static_cast<float>(i); };
+
+    auto [unseq_values] =
+      ex::sync_wait(ex::just(values) | ex::bulk(ex::unseq, n, scale)).value();
+    exec::static_thread_pool pool{4};
+    auto [par_unseq_values] = ex::sync_wait(
+                                ex::starts_on(
+                                  pool.get_scheduler(),
+                                  ex::just(values) | ex::bulk(ex::par_unseq, n, scale)))
+                                .value();
+
+    for (int i = 0; i < n; ++i) {
+      CHECK(unseq_values[i] == static_cast<float>(i));
+      CHECK(par_unseq_values[i] == static_cast<float>(i));
+    }
+  }
+
   TEST_CASE("bulk_chunked works with all standard execution policies", "[adaptors][bulk]") {
     ex::sender auto snd1 = ex::just() | ex::bulk_chunked(ex::seq, 9, [](int, int) { });
     ex::sender auto snd2 = ex::just() | ex::bulk_chunked(ex::par, 9, [](int, int) { });
@@ -236,6 +236,35 @@ namespace {
     CHECK(cancelled);
   }
 
+  TEST_CASE(
+    "when_all gives its children a stoppable token only if stop can be requested",
+    "[adaptors][when_all]") {
+    auto child_token = ex::read_env(ex::get_stop_token);
+
+    // Nothing can request stop: the children cannot fail and the receiver cannot be stopped.
+    auto [token, value] = ex::sync_wait(ex::when_all(child_token, ex::just(1))).value();
+    CHECK_FALSE(token.stop_possible());
+
+    // A child that may throw can ask the others to stop.
+    auto [token2, value2] =
+      ex::sync_wait(ex::when_all(child_token, ex::just(1) | ex::then([](int i) { return i; })))
+        .value();
+    CHECK(token2.stop_possible());
+
+    // The receiver can ask the children to stop.
+    ex::inplace_stop_source stop_source;
+    auto [token3, value3] =
+      ex::sync_wait(
+        exec::write_env(
+          ex::when_all(child_token, ex::just(1)),
+          ex::prop{ex::get_stop_token, stop_source.get_token()}))
+        .value();
+    CHECK(token3.stop_possible());
+    (void) value;
+    (void) value2;
+    (void) value3;
+  }
+
   TEST_CASE(
     "when_all has the values_type based on the children, decayed and as rvalue references",
     "[adaptors][when_all]") {
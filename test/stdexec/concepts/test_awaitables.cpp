@@ -19,9 +19,13 @@
 
 #include <exec/static_thread_pool.hpp>
 #include <stdexec/coroutine.hpp>
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #include <variant>
 
+#include <test_common/allocators.hpp>
+#include <test_common/receivers.hpp>
 #include <test_common/type_helpers.hpp>
 
 #if !STDEXEC_STD_NO_COROUTINES()
@@ -256,6 +260,22 @@ namespace {
     using _Promise = ex::__env::__promise<ex::env<>>;
     static_assert(!ex::__awaitable<_Awaitable, _Promise>);
   }
+
+  TEST_CASE(
+    "connecting an awaitable allocates the coroutine frame with the allocator of the receiver",
+    "[sndtraits][awaitables]") {
+    counting_allocator<std::byte>::allocations = 0;
+    counting_allocator<std::byte>::deallocations = 0;
+    {
+      auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{}};
+      auto op = ex::connect(
+        awaitable_sender_1<awaiter>{}, expect_value_receiver{env_tag{}, env, false});
+      CHECK(counting_allocator<std::byte>::allocations == 1);
+      ex::start(op);
+    }
+    CHECK(counting_allocator<std::byte>::allocations == 1);
+    CHECK(counting_allocator<std::byte>::deallocations == 1);
+  }
 } // namespace
 
 #endif // STDEXEC_STD_NO_COROUTINES()
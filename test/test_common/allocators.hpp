@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace {
+
+  //! An allocator that counts the allocations and deallocations made through it, or through
+  //! any of its rebound copies. Tests reset the counts before they use it.
+  template <class T>
+  struct counting_allocator {
+    using value_type = T;
+
+    static inline int allocations = 0;
+    static inline int deallocations = 0;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {
+    }
+
+    auto allocate(std::size_t n) -> T* {
+      ++counting_allocator<std::byte>::allocations;
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      ++counting_allocator<std::byte>::deallocations;
+      std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    friend auto operator==(counting_allocator, counting_allocator<U>) noexcept -> bool {
+      return true;
+    }
+  };
+} // namespace